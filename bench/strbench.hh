@@ -0,0 +1,556 @@
+/**
+ * @file strbench.hh
+ * @author Ian Hylton
+ * @brief A small self-contained microbenchmark harness for the strTools suite.
+ * @version 1.0.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) zperk 2024
+ *
+ */
+
+#pragma once
+
+#include "../src/.hxx"
+#include "strperf.hh"
+#include <algorithm>
+#include <barrier>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using std::string, std::string_view;
+
+/**
+ * @brief Keeps the compiler from optimizing away a value the benchmark computed.
+ */
+template<class T>
+inline void __strBenchKeep(const T& value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile( "" : : "r,m"( value ) : "memory" );
+#else
+	static const void* volatile sink;
+	sink = &value;
+#endif
+}
+
+/**
+ * @brief Formats a byte count as "16B", "4KiB", "64MiB".
+ */
+inline string __strBenchSize(const uint64_t bytes) {
+	if( bytes >= ( 1 << 20 ) && bytes % ( 1 << 20 ) == 0 ) return std::to_string(bytes >> 20) + "MiB";
+	if( bytes >= ( 1 << 10 ) && bytes % ( 1 << 10 ) == 0 ) return std::to_string(bytes >> 10) + "KiB";
+	return std::to_string(bytes) + "B";
+}
+
+/**
+ * @brief The measurements of one benchmark case.
+ */
+struct __StrBenchResult {
+	/// @brief The function measured, e.g. "findSubStr".
+	string name;
+	/// @brief What the input looks like, e.g. "text/absent" or "threads=8".
+	string variant;
+	/// @brief Bytes processed by one operation (0 when it is not about bytes).
+	uint64_t bytes = 0;
+	/// @brief Operations timed per sample.
+	uint64_t iterations = 0;
+	/// @brief Nanoseconds per operation of every sample.
+	std::vector<double> samples;
+	/// @brief Median of `samples`.
+	double nsPerOp = 0;
+	/// @brief `bytes` per `nsPerOp`, in GB/s (0 when `bytes` is 0).
+	double gbPerSec = 0;
+	/// @brief Heap allocations per operation (-1 without `STRTOOLS_TRACK_ALLOC`).
+	double allocsPerOp = -1;
+	/// @brief Hardware counters per operation (all -1 when unavailable).
+	__StrPerfSample counters;
+	/// @brief Case-specific figures added with `__StrBench::note` (e.g. bytes saved).
+	std::vector<std::pair<string, double>> metrics;
+
+	/**
+	 * @brief The key a baseline is matched on: "name/variant/size".
+	 */
+	string id() const {
+		string r = name;
+		if( !variant.empty() ) r += "/" + variant;
+		if( bytes ) r += "/" + __strBenchSize(bytes);
+		return r;
+	}
+};
+
+/**
+ * @brief Command-line options of a benchmark run.
+ */
+struct __StrBenchOptions {
+	/// @brief Run only cases whose id contains one of these comma-separated words.
+	string filter;
+	/// @brief Write the results here as JSON as well ("-": stdout, with the table on stderr).
+	string jsonPath;
+	/// @brief Minimum duration of one sample, in milliseconds.
+	double minTimeMs = 10;
+	/// @brief Samples per case; the median is reported.
+	unsigned repeats = 5;
+	/// @brief Largest input size.
+	uint64_t maxSize = uint64_t(64) << 20;
+	/// @brief Largest thread count of the multi-threaded cases.
+	unsigned maxThreads = 64;
+	/// @brief Print the case ids instead of running them.
+	bool list = false;
+	/// @brief Read the hardware performance counters around each case.
+	bool counters = true;
+	/// @brief The arguments that select and time the cases (all but `--json`), for reruns.
+	std::vector<string> args;
+
+	/**
+	 * @brief Reads the options from the command line.
+	 *
+	 * @return `false` (after printing the usage to `err`) on a bad argument.
+	 */
+	bool parse(const int argc, char** argv, std::ostream& err) {
+		for( int i = 1; i < argc; ++i ) {
+			const string_view arg = argv[i];
+			const auto value = [&](string_view key) -> const char* {
+				return arg.size() > key.size() && arg.substr(0, key.size()) == key ? argv[i] + key.size() : nullptr;
+			};
+			if( const char* v = value("--filter=") ) {
+				filter = v;
+			} else if( const char* v = value("--json=") ) {
+				jsonPath = v;
+			} else if( const char* v = value("--min-time=") ) {
+				minTimeMs = std::atof(v);
+			} else if( const char* v = value("--repeats=") ) {
+				repeats = static_cast<unsigned>( std::max(1, std::atoi(v)) );
+			} else if( const char* v = value("--max-size=") ) {
+				maxSize = parseSize(v);
+			} else if( const char* v = value("--max-threads=") ) {
+				maxThreads = static_cast<unsigned>( std::max(1, std::atoi(v)) );
+			} else if( arg == "--quick" ) {
+				minTimeMs = 2;
+				repeats = 3;
+				maxSize = 1 << 20;
+				maxThreads = std::min(maxThreads, 8u);
+			} else if( arg == "--list" ) {
+				list = true;
+			} else if( arg == "--no-counters" ) {
+				counters = false;
+			} else {
+				err << "usage: " << argv[0] << " [--filter=a,b] [--json=out.json] [--min-time=ms] [--repeats=n]\n"
+					<< "       [--max-size=64M] [--max-threads=64] [--quick] [--list] [--no-counters]\n";
+				return false;
+			}
+			if( !value("--json=") ) args.emplace_back(arg);
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Parses "4096", "64K" or "64M".
+	 */
+	static uint64_t parseSize(const char* s) {
+		char* end = nullptr;
+		uint64_t n = std::strtoull(s, &end, 10);
+		if( *end == 'K' || *end == 'k' ) n <<= 10;
+		if( *end == 'M' || *end == 'm' ) n <<= 20;
+		if( *end == 'G' || *end == 'g' ) n <<= 30;
+		return n;
+	}
+};
+
+/**
+ * @class __StrBenchCrew
+ * @brief A fixed group of threads that run a batch together.
+ *
+ * The threads are started once, so a multi-threaded sample measures the
+ * operations and not thread creation.
+ */
+class __StrBenchCrew {
+private:
+	std::vector<std::thread> threads;
+	std::barrier<> start;
+	std::barrier<> done;
+	std::function<void(unsigned, uint64_t)> work;
+	uint64_t perThread = 0;
+	bool stopping = false;
+
+public:
+	explicit __StrBenchCrew(const unsigned n) : start(n + 1), done(n + 1) {
+		for( unsigned t = 0; t < n; ++t ) {
+			threads.emplace_back([this, t] {
+				for( ;;) {
+					start.arrive_and_wait();
+					if( stopping ) return;
+					work(t, perThread);
+					done.arrive_and_wait();
+				}
+			});
+		}
+	}
+
+	~__StrBenchCrew() {
+		stopping = true;
+		start.arrive_and_wait();
+		for( auto& t : threads ) t.join();
+	}
+
+	/**
+	 * @brief Runs `body(thread, iterations)` on every thread and waits for all of them.
+	 */
+	void run(const std::function<void(unsigned, uint64_t)>& body, const uint64_t iterations) {
+		work = body;
+		perThread = iterations;
+		start.arrive_and_wait();
+		done.arrive_and_wait();
+	}
+
+	unsigned size() const noexcept {
+		return static_cast<unsigned>( threads.size() );
+	}
+};
+
+/**
+ * @class __StrBench
+ * @brief Times benchmark cases and reports them as text and JSON.
+ *
+ * A case is a batch function taking an iteration count. The harness grows
+ * the count until one batch lasts `minTimeMs`, then times `repeats` batches
+ * and reports the median nanoseconds per operation and the throughput.
+ *
+ * @note Example usage:
+ * @code
+ * __StrBench bench(options, std::cout);
+ * bench.run("findSubStr", "text/absent", text.size(), [&](uint64_t n) {
+ *     for( uint64_t k = 0; k < n; ++k ) __strBenchKeep(strTools::findSubStr(text, needle));
+ * });
+ * bench.writeJson(file);
+ * @endcode
+ */
+class __StrBench {
+private:
+	using Clock = std::chrono::steady_clock;
+
+	__StrBenchOptions options;
+	std::vector<__StrBenchResult> results;
+	std::ostream& out;
+	/// @brief Counts the calling thread only, so multi-threaded cases go without.
+	std::unique_ptr<__StrPerfCounters> perf;
+	bool threaded = false;
+
+	template<class F>
+	static double timeBatch(F& batch, const uint64_t n) {
+		const auto t0 = Clock::now();
+		batch(n);
+		return std::chrono::duration<double, std::nano>(Clock::now() - t0).count();
+	}
+
+	static double median(std::vector<double> v) {
+		std::sort(v.begin(), v.end());
+		const size_t m = v.size() / 2;
+		return v.size() % 2 ? v[m] : ( v[m - 1] + v[m] ) / 2;
+	}
+
+	bool selected(const string& id) const {
+		if( options.filter.empty() ) return true;
+		size_t from = 0;
+		while( from <= options.filter.size() ) {
+			const size_t comma = std::min(options.filter.find(',', from), options.filter.size());
+			const string word = options.filter.substr(from, comma - from);
+			if( !word.empty() && id.find(word) != string::npos ) return true;
+			from = comma + 1;
+		}
+		return false;
+	}
+
+	void print(const __StrBenchResult& r) {
+		out << std::left << std::setw(44) << r.id() << std::right << std::fixed
+			<< std::setw(14) << std::setprecision(1) << r.nsPerOp << " ns/op";
+		if( r.bytes ) out << std::setw(10) << std::setprecision(3) << r.gbPerSec << " GB/s";
+		else if( r.allocsPerOp >= 0 ) out << std::setw(15) << "";
+		if( r.allocsPerOp >= 0 ) out << std::setw(9) << std::setprecision(2) << r.allocsPerOp << " allocs/op";
+		const __StrPerfSample& c = r.counters;
+		if( c.ipc() >= 0 ) out << std::setw(7) << std::setprecision(2) << c.ipc() << " IPC";
+		if( r.bytes ) {
+			const double b = static_cast<double>( r.bytes );
+			if( c.l1dMisses >= 0 ) out << std::setw(9) << std::setprecision(4) << c.l1dMisses / b << " L1D/B";
+			if( c.llcMisses >= 0 ) out << std::setw(9) << std::setprecision(4) << c.llcMisses / b << " LLC/B";
+		}
+		if( c.branchMisses >= 0 ) out << std::setw(9) << std::setprecision(2) << c.branchMisses << " brmiss/op";
+		out << std::defaultfloat << "\n" << std::flush;
+	}
+
+	/**
+	 * @brief Writes the per-operation counters and the ratios derived from them.
+	 */
+	static void writeCounters(std::ostream& json, const __StrBenchResult& r) {
+		const __StrPerfSample& c = r.counters;
+		const double b = static_cast<double>( r.bytes );
+		const std::pair<const char*, double> fields[] = {
+			{ "cycles", c.cycles },
+			{ "instructions", c.instructions },
+			{ "l1d_misses", c.l1dMisses },
+			{ "llc_misses", c.llcMisses },
+			{ "branch_misses", c.branchMisses },
+			{ "ipc", c.ipc() },
+			{ "cycles_per_byte", r.bytes ? c.cycles / b : -1 },
+			{ "l1d_misses_per_byte", r.bytes && c.l1dMisses >= 0 ? c.l1dMisses / b : -1 },
+			{ "llc_misses_per_byte", r.bytes && c.llcMisses >= 0 ? c.llcMisses / b : -1 },
+		};
+		json << ",\"counters\":{";
+		bool first = true;
+		for( const auto& [key, value] : fields ) {
+			if( value < 0 ) continue;
+			json << ( first ? "\"" : ",\"" ) << key << "\":" << value;
+			first = false;
+		}
+		json << "}";
+	}
+
+	static void writeString(std::ostream& json, string_view s) {
+		json << '"';
+		for( const char c : s ) {
+			if( c == '"' || c == '\\' ) json << '\\';
+			json << c;
+		}
+		json << '"';
+	}
+
+public:
+	explicit __StrBench(const __StrBenchOptions& options, std::ostream& out) : options(options), out(out) {
+		if( !options.counters || options.list ) return;
+		perf = std::make_unique<__StrPerfCounters>();
+		if( !perf->available() ) {
+			std::cerr << "Hardware counters unavailable (" << perf->unavailableReason() << "); timing only.\n";
+			perf.reset();
+		}
+	}
+
+	/**
+	 * @brief Checks whether the results include hardware counters.
+	 */
+	bool counting() const noexcept {
+		return perf != nullptr;
+	}
+
+	/**
+	 * @brief Checks whether this binary was built with optimizations.
+	 */
+	static constexpr bool optimized() noexcept {
+#if defined(__OPTIMIZE__) || ( defined(_MSC_VER) && defined(NDEBUG) )
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	const __StrBenchOptions& settings() const noexcept {
+		return options;
+	}
+
+	/**
+	 * @brief Gets the sizes to run: 16 B and every fourfold step up to `maxSize`.
+	 */
+	std::vector<uint64_t> sizes() const {
+		std::vector<uint64_t> r;
+		for( uint64_t n = 16; n <= options.maxSize; n *= 4 ) r.push_back(n);
+		return r;
+	}
+
+	/**
+	 * @brief Gets the thread counts to run: 1, 2, 4 ... `maxThreads`.
+	 */
+	std::vector<unsigned> threadCounts() const {
+		std::vector<unsigned> r;
+		for( unsigned n = 1; n <= options.maxThreads; n *= 2 ) r.push_back(n);
+		return r;
+	}
+
+	/**
+	 * @brief Times one case.
+	 *
+	 * @param name The function measured.
+	 * @param variant What the input looks like.
+	 * @param bytes Bytes processed per operation (0: report ns/op only).
+	 * @param batch Called with an iteration count; runs that many iterations.
+	 * @param opsPerIteration Operations one iteration performs.
+	 * @return The result, or `nullptr` if the case was filtered out or only listed.
+	 */
+	template<class F>
+	__StrBenchResult* run(const string& name, const string& variant, const uint64_t bytes, F&& batch, const uint64_t opsPerIteration = 1) {
+		__StrBenchResult r;
+		r.name = name;
+		r.variant = variant;
+		r.bytes = bytes;
+		if( !selected(r.id()) ) return nullptr;
+		if( options.list ) {
+			out << r.id() << "\n";
+			return nullptr;
+		}
+
+		const double target = options.minTimeMs * 1e6;
+		uint64_t n = 1;
+		for( ;;) {
+			const double t = timeBatch(batch, n);
+			if( t >= target || n >= ( uint64_t(1) << 40 ) ) break;
+			const double grow = t > 0 ? target * 1.2 / t : 100;
+			n = static_cast<uint64_t>( static_cast<double>( n ) * std::clamp(grow, 2.0, 100.0) );
+		}
+		r.iterations = n;
+		__StrPerfCounters* const counters = threaded ? nullptr : perf.get();
+		if( counters ) counters->start();
+		for( unsigned i = 0; i < options.repeats; ++i ) {
+#ifdef STRTOOLS_TRACK_ALLOC
+			const uint64_t before = i + 1 == options.repeats ? __StrAllocTracker::allocationCount() : 0;
+#endif
+			r.samples.push_back(timeBatch(batch, n) / static_cast<double>( n * opsPerIteration ));
+#ifdef STRTOOLS_TRACK_ALLOC
+			if( i + 1 == options.repeats ) r.allocsPerOp = static_cast<double>( __StrAllocTracker::allocationCount() - before ) / static_cast<double>( n * opsPerIteration );
+#endif
+		}
+		if( counters ) {
+			// Totals over every sample, per operation.
+			const double ops = static_cast<double>( n * opsPerIteration * options.repeats );
+			r.counters = counters->stop();
+			for( double* v : { &r.counters.cycles, &r.counters.instructions, &r.counters.l1dMisses, &r.counters.llcMisses, &r.counters.branchMisses } ) {
+				if( *v >= 0 ) *v /= ops;
+			}
+		}
+		r.nsPerOp = median(r.samples);
+		r.gbPerSec = bytes && r.nsPerOp > 0 ? static_cast<double>( bytes ) / r.nsPerOp : 0;
+		print(r);
+		results.push_back(std::move(r));
+		return &results.back();
+	}
+
+	/**
+	 * @brief Times a case of one call per iteration: `op()`, whose result is kept.
+	 */
+	template<class F>
+	__StrBenchResult* runEach(const string& name, const string& variant, const uint64_t bytes, F&& op) {
+		return run(name, variant, bytes, [&op](const uint64_t n) {
+			for( uint64_t i = 0; i < n; ++i ) {
+				if constexpr( std::is_void_v<decltype( op() )> ) op();
+				else __strBenchKeep(op());
+			}
+		});
+	}
+
+	/**
+	 * @brief Times a multi-threaded case: every thread of `crew` runs
+	 * `body(thread, iterations)`.
+	 *
+	 * ns/op is wall time over the operations of all threads, i.e. the inverse
+	 * of the combined throughput. Hardware counters are not read: they would
+	 * only see the waiting calling thread.
+	 *
+	 * @param opsPerIteration Operations one iteration of `body` performs.
+	 * @return The result, or `nullptr` if the case was filtered out or only listed.
+	 */
+	template<class F>
+	__StrBenchResult* runThreads(const string& name, const string& variant, __StrBenchCrew& crew, F&& body,
+		const uint64_t opsPerIteration = 1) {
+		const unsigned threads = crew.size();
+		const std::function<void(unsigned, uint64_t)> work = body;
+		threaded = true;
+		__StrBenchResult* r = run(name, variant + ( variant.empty() ? "" : "/" ) + "threads=" + std::to_string(threads), 0, [&](const uint64_t n) {
+			crew.run(work, n);
+		}, threads * opsPerIteration);
+		threaded = false;
+		return r;
+	}
+
+	/**
+	 * @brief Adds a case-specific figure to a result and prints it under the case.
+	 *
+	 * @param r The result returned by `run`, `runEach` or `runThreads` (ignored if `nullptr`).
+	 * @param key The figure's name, e.g. "saved_pct".
+	 * @param value Its value.
+	 */
+	void note(__StrBenchResult* r, const string& key, const double value) {
+		if( !r ) return;
+		r->metrics.emplace_back(key, value);
+		out << "    " << key << " = " << std::fixed << std::setprecision(value == std::floor(value) ? 0 : 2) << value << "\n"
+			<< std::flush;
+	}
+
+	const std::vector<__StrBenchResult>& all() const noexcept {
+		return results;
+	}
+
+	/**
+	 * @brief Writes every result as JSON.
+	 */
+	void writeJson(std::ostream& json) const {
+		const std::time_t now = std::time(nullptr);
+		char date[32] = {};
+		std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+		json << "{\n\"context\":{\"date\":\"" << date << "\",\"compiler\":";
+#if defined(__clang__)
+		writeString(json, "clang " __clang_version__);
+#elif defined(__GNUC__)
+		writeString(json, "gcc " __VERSION__);
+#elif defined(_MSC_VER)
+		writeString(json, "msvc " + std::to_string(_MSC_VER));
+#else
+		writeString(json, "unknown");
+#endif
+		json << ",\"threads\":" << std::thread::hardware_concurrency() << ",\"repeats\":" << options.repeats
+			<< ",\"min_time_ms\":" << options.minTimeMs << ",\"args\":[";
+		for( size_t i = 0; i < options.args.size(); ++i ) {
+			json << ( i ? "," : "" );
+			writeString(json, options.args[i]);
+		}
+		json << "],\"optimized\":" << ( optimized() ? "true" : "false" ) << ",\"profile\":"
+#ifdef STRTOOLS_PROFILE
+			<< "true"
+#else
+			<< "false"
+#endif
+			<< ",\"counters\":" << ( counting() ? "true" : "false" ) << ",\"track_alloc\":"
+#ifdef STRTOOLS_TRACK_ALLOC
+			<< "true"
+#else
+			<< "false"
+#endif
+			<< "},\n\"benchmarks\":[";
+		json << std::setprecision(6);
+		for( size_t i = 0; i < results.size(); ++i ) {
+			const auto& r = results[i];
+			json << ( i ? "," : "" ) << "\n{\"id\":";
+			writeString(json, r.id());
+			json << ",\"name\":";
+			writeString(json, r.name);
+			json << ",\"variant\":";
+			writeString(json, r.variant);
+			json << ",\"bytes\":" << r.bytes << ",\"iterations\":" << r.iterations << ",\"ns_per_op\":" << r.nsPerOp
+				<< ",\"gb_per_s\":" << r.gbPerSec << ",\"samples_ns\":[";
+			for( size_t k = 0; k < r.samples.size(); ++k ) json << ( k ? "," : "" ) << r.samples[k];
+			json << "]";
+			if( r.allocsPerOp >= 0 ) json << ",\"allocs_per_op\":" << r.allocsPerOp;
+			if( r.counters.cycles >= 0 ) writeCounters(json, r);
+			if( !r.metrics.empty() ) {
+				json << ",\"metrics\":{";
+				for( size_t k = 0; k < r.metrics.size(); ++k ) {
+					json << ( k ? "," : "" );
+					writeString(json, r.metrics[k].first);
+					json << ":" << std::setprecision(15) << r.metrics[k].second << std::setprecision(6);
+				}
+				json << "}";
+			}
+			json << "}";
+		}
+		json << "\n]}\n";
+	}
+};
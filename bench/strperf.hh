@@ -0,0 +1,210 @@
+/**
+ * @file strperf.hh
+ * @author Ian Hylton
+ * @brief Hardware performance counters (Linux `perf_event_open`) for the benchmarks.
+ * @version 1.0.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) zperk 2024
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#ifdef __linux__
+#include <cerrno>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using std::string;
+
+/**
+ * @brief Counter totals of one measured block, scaled for multiplexing.
+ *
+ * A counter the CPU or kernel does not provide stays at -1.
+ */
+struct __StrPerfSample {
+	double cycles = -1;
+	double instructions = -1;
+	double l1dMisses = -1;
+	double llcMisses = -1;
+	double branchMisses = -1;
+
+	/**
+	 * @brief Gets instructions per cycle, or -1 if either is missing.
+	 */
+	double ipc() const noexcept {
+		return cycles > 0 && instructions >= 0 ? instructions / cycles : -1;
+	}
+};
+
+/**
+ * @class __StrPerfCounters
+ * @brief Counts cycles, instructions, L1D/LLC misses and branch mispredicts
+ * of the calling thread.
+ *
+ * The counters are opened as one group, so they are scheduled on the PMU
+ * together and their ratios (IPC, misses per byte) stay consistent. Only
+ * user-space work is counted, which `perf_event_paranoid` levels up to 2
+ * allow. When the cycle counter cannot be opened at all (no PMU in a VM or
+ * container, paranoid level 3, not Linux), `available()` is `false` and the
+ * benchmarks report timing only; counters missing on their own are left out.
+ *
+ * @note Example usage:
+ * @code
+ * __StrPerfCounters counters;
+ * if( counters.available() ) {
+ *     counters.start();
+ *     runWorkload();
+ *     __StrPerfSample s = counters.stop();
+ *     std::cout << "IPC " << s.ipc() << "\n";
+ * }
+ * @endcode
+ */
+class __StrPerfCounters {
+public:
+	/// @brief The counters, in the order of `__StrPerfSample`'s fields.
+	static constexpr int eventCount = 5;
+
+private:
+	int fds[eventCount];
+	/// @brief The kernel's ID of each counter, to match the values of a group read.
+	uint64_t ids[eventCount] = {};
+	int leader = -1;
+	string reason;
+
+#ifdef __linux__
+	struct Event {
+		uint32_t type;
+		uint64_t config;
+	};
+
+	static constexpr Event events[eventCount] = {
+		{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+		{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+		// Cache events are encoded as cache | op << 8 | result << 16.
+		{ PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) | ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 ) },
+		{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+		{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+	};
+
+	static int open(const Event& e, const int group) noexcept {
+		perf_event_attr attr;
+		memset(&attr, 0, sizeof(attr));
+		attr.size = sizeof(attr);
+		attr.type = e.type;
+		attr.config = e.config;
+		attr.disabled = group == -1;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+		return static_cast<int>( syscall(SYS_perf_event_open, &attr, 0, -1, group, 0) );
+	}
+#endif
+
+public:
+	__StrPerfCounters() noexcept {
+		for( int& fd : fds ) fd = -1;
+#ifdef __linux__
+		leader = fds[0] = open(events[0], -1);
+		if( leader < 0 ) {
+			reason = string("perf_event_open: ") + strerror(errno);
+			return;
+		}
+		for( int i = 1; i < eventCount; ++i ) fds[i] = open(events[i], leader);
+		for( int i = 0; i < eventCount; ++i ) {
+			if( fds[i] >= 0 && ioctl(fds[i], PERF_EVENT_IOC_ID, &ids[i]) != 0 ) {
+				close(fds[i]);
+				fds[i] = -1;
+			}
+		}
+		if( fds[0] < 0 ) {
+			leader = -1;
+			reason = "perf_event_open: cannot identify the cycle counter";
+			for( int& fd : fds ) {
+				if( fd >= 0 ) close(fd);
+				fd = -1;
+			}
+		}
+#else
+		reason = "performance counters need Linux perf_event_open";
+#endif
+	}
+
+	~__StrPerfCounters() {
+#ifdef __linux__
+		// Members first: closing the leader would orphan them.
+		for( int i = eventCount - 1; i >= 0; --i ) {
+			if( fds[i] >= 0 ) close(fds[i]);
+		}
+#endif
+	}
+
+	__StrPerfCounters(const __StrPerfCounters&) = delete;
+	__StrPerfCounters& operator=(const __StrPerfCounters&) = delete;
+
+	/**
+	 * @brief Checks whether counting works; without it `stop()` returns an empty sample.
+	 */
+	bool available() const noexcept {
+		return leader >= 0;
+	}
+
+	/**
+	 * @brief Tells why the counters are unavailable.
+	 */
+	const string& unavailableReason() const noexcept {
+		return reason;
+	}
+
+	/**
+	 * @brief Zeroes and starts the counters.
+	 */
+	void start() noexcept {
+#ifdef __linux__
+		if( leader < 0 ) return;
+		ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+		ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+	}
+
+	/**
+	 * @brief Stops the counters and reads them.
+	 *
+	 * If the group shared the PMU with other events, the counts are scaled
+	 * up by enabled/running time, as `perf stat` does.
+	 */
+	__StrPerfSample stop() noexcept {
+		__StrPerfSample s;
+#ifdef __linux__
+		if( leader < 0 ) return s;
+		ioctl(leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+		// { nr, time_enabled, time_running, { value, id } * nr }
+		uint64_t buffer[3 + 2 * eventCount] = {};
+		if( read(leader, buffer, sizeof(buffer)) < static_cast<ssize_t>( 3 * sizeof(uint64_t) ) ) return s;
+		const uint64_t nr = buffer[0], enabled = buffer[1], running = buffer[2];
+		if( running == 0 ) return s;
+		const double scale = static_cast<double>( enabled ) / static_cast<double>( running );
+
+		double* fields[eventCount] = { &s.cycles, &s.instructions, &s.l1dMisses, &s.llcMisses, &s.branchMisses };
+		for( uint64_t k = 0; k < nr && k < eventCount; ++k ) {
+			const uint64_t value = buffer[3 + 2 * k], id = buffer[4 + 2 * k];
+			for( int i = 0; i < eventCount; ++i ) {
+				if( fds[i] >= 0 && ids[i] == id ) {
+					*fields[i] = static_cast<double>( value ) * scale;
+					break;
+				}
+			}
+		}
+#endif
+		return s;
+	}
+};
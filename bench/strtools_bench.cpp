@@ -0,0 +1,405 @@
+/**
+ * @file strtools_bench.cpp
+ * @author Ian Hylton
+ * @brief Microbenchmarks of every strTools and strUtil string function.
+ * @version 1.0.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) zperk 2024
+ *
+ * Usage: strtools_bench [--filter=a,b] [--json=out.json] [--min-time=ms] [--repeats=n]
+ *                       [--max-size=64M] [--max-threads=64] [--quick] [--list]
+ *
+ * Case ids read "function/overload/alphabet/density/size", e.g.
+ * "findSubStr/sv/dna/absent/4KiB"; `--filter` keeps the ids containing any
+ * of its words. `--json=-` writes the JSON to stdout and the table to
+ * stderr. Interactive functions (`clearScr`, `userInputHandler`,
+ * `isCapturedValueInvalid`) are not measured.
+ */
+
+#include "strbench.hh"
+#include <fstream>
+#include <iostream>
+#include <memory_resource>
+
+/// @brief The alphabets inputs are drawn from.
+static const char* const alphabets[] = { "binary", "dna", "lower", "text", "utf8" };
+
+/// @brief Never occurs in a generated input (0xFF is not valid UTF-8 either).
+static constexpr char absentChar = '\xFF';
+
+/**
+ * @brief Builds a pseudo-random input of exactly `size` bytes.
+ *
+ * - binary: any byte but 0 and 0xFF.
+ * - dna: "ACGT", so short needles match often.
+ * - lower: 'a'-'z'.
+ * - text: words, spaces, capitals, punctuation and a newline every ~80 bytes.
+ * - utf8: valid UTF-8, half ASCII and half 2-, 3- and 4-byte characters.
+ */
+static string makeInput(string_view alphabet, const uint64_t size, uint64_t seed = 1) {
+	uint64_t x = seed * 0x9E3779B97F4A7C15ULL | 1;
+	const auto next = [&x] {
+		x ^= x << 13;
+		x ^= x >> 7;
+		x ^= x << 17;
+		return x;
+	};
+	string s;
+	s.reserve(size + 4);
+	if( alphabet == "binary" ) {
+		while( s.size() < size ) s.push_back(static_cast<char>( 1 + next() % 254 ));
+	} else if( alphabet == "dna" ) {
+		while( s.size() < size ) s.push_back("ACGT"[next() & 3]);
+	} else if( alphabet == "lower" ) {
+		while( s.size() < size ) s.push_back(static_cast<char>( 'a' + next() % 26 ));
+	} else if( alphabet == "text" ) {
+		uint64_t line = 0;
+		while( s.size() < size ) {
+			const uint64_t r = next();
+			char c = static_cast<char>( 'a' + r % 26 );
+			if( ++line >= 80 ) {
+				c = '\n';
+				line = 0;
+			} else if( r % 6 == 0 ) {
+				c = ' ';
+			} else if( r % 8 == 1 ) {
+				c = static_cast<char>( 'A' + r % 26 );
+			} else if( r % 53 == 2 ) {
+				c = ".,;:!?"[r % 6];
+			}
+			s.push_back(c);
+		}
+	} else {
+		static const char* const wide[] = { "\xC3\xA9", "\xC3\x9F", "\xD0\x96", "\xCE\xA3", "\xE4\xB8\xAD", "\xF0\x9F\x98\x80" };
+		while( s.size() < size ) {
+			const uint64_t r = next();
+			if( r & 1 ) s.push_back(static_cast<char>( ( r & 2 ? 'A' : 'a' ) + ( r >> 8 ) % 26 ));
+			else s += wide[( r >> 8 ) % 6];
+		}
+		// Cut on a character boundary and pad back to `size` with ASCII.
+		uint64_t n = size;
+		while( n > 0 && ( static_cast<unsigned char>( s[n] ) & 0xC0 ) == 0x80 ) --n;
+		s.resize(n);
+		s.append(size - n, 'a');
+	}
+	return s;
+}
+
+/**
+ * @brief Builds a needle that only matches partially: the middle of `s` plus `absentChar`.
+ */
+static string absentNeedle(string_view s) {
+	string n(s.substr(s.size() / 2, 15));
+	n.push_back(absentChar);
+	return n;
+}
+
+/**
+ * @brief Builds a needle taken from the last 16 bytes of `s`.
+ */
+static string endNeedle(string_view s) {
+	return string(s.substr(s.size() > 16 ? s.size() - 16 : 0));
+}
+
+/**
+ * @brief concatStr, subStr, insertStr and delSubStr: every overload, text input.
+ *
+ * Overloads: "sv" (string_view, uniqueStr result), "small" (into a reused
+ * smallStr), "pmr" (smallStr from a pool resource), "cstr" (const char*)
+ * and "slice" (strSlice, no copy).
+ */
+static void benchBuild(__StrBench& bench) {
+	std::pmr::unsynchronized_pool_resource pool;
+	for( const uint64_t n : bench.sizes() ) {
+		const string s = makeInput("text", n);
+		const string left = s.substr(0, n / 2), right = s.substr(n / 2);
+		const string insert = "[inserted text.]";
+		const char* const cs = s.c_str();
+		const sharedStr shared = strUtil::makeSharedStr(cs);
+		const strSlice slice(shared);
+		const string_view sv = s;
+		smallStr r;
+
+		bench.runEach("concatStr", "sv/text", n, [&] { return strTools::concatStr(string_view(left), string_view(right)); });
+		bench.runEach("concatStr", "small/text", n, [&] { strTools::concatStr(r, left, right); return r.data(); });
+		bench.runEach("concatStr", "pmr/text", n, [&] { return strTools::concatStr(left, right, &pool); });
+		bench.runEach("concatStr", "cstr/text", n, [&] { return strTools::concatStr(left.c_str(), right.c_str()); });
+
+		bench.runEach("subStr", "sv/text", n, [&] { return strTools::subStr(sv, n / 4, n / 2); });
+		bench.runEach("subStr", "small/text", n, [&] { strTools::subStr(r, sv, n / 4, n / 2); return r.data(); });
+		bench.runEach("subStr", "pmr/text", n, [&] { return strTools::subStr(sv, n / 4, n / 2, &pool); });
+		bench.runEach("subStr", "cstr/text", n, [&] { return strTools::subStr(cs, n / 4, n / 2); });
+		bench.runEach("subStr", "slice/text", n, [&] { return strTools::subStr(slice, n / 4, n / 2); });
+
+		bench.runEach("insertStr", "sv/text", n, [&] { return strTools::insertStr(sv, string_view(insert), n / 2 + 1); });
+		bench.runEach("insertStr", "small/text", n, [&] { strTools::insertStr(r, sv, insert, n / 2 + 1); return r.data(); });
+		bench.runEach("insertStr", "pmr/text", n, [&] { return strTools::insertStr(sv, insert, n / 2 + 1, &pool); });
+		bench.runEach("insertStr", "cstr/text", n, [&] { return strTools::insertStr(cs, insert.c_str(), n / 2 + 1); });
+
+		bench.runEach("delSubStr", "sv/text", n, [&] { return strTools::delSubStr(sv, n / 4 + 1, n / 2); });
+		bench.runEach("delSubStr", "small/text", n, [&] { strTools::delSubStr(r, sv, n / 4 + 1, n / 2); return r.data(); });
+		bench.runEach("delSubStr", "pmr/text", n, [&] { return strTools::delSubStr(sv, n / 4 + 1, n / 2, &pool); });
+		bench.runEach("delSubStr", "cstr/text", n, [&] { return strTools::delSubStr(cs, n / 4 + 1, n / 2); });
+	}
+}
+
+/**
+ * @brief findSubStr and replaceStr over every alphabet and match density.
+ *
+ * Densities: "absent" (the needle's first 15 bytes occur, the whole never
+ * does), "end" (the last 16 bytes), and "partial" (a run of 'a' searched
+ * for "aaa...ab", the worst case of a naive search).
+ */
+static void benchSearch(__StrBench& bench) {
+	const string replacement = "<replacement>";
+	for( const char* alphabet : alphabets ) {
+		const string a = alphabet;
+		for( const uint64_t n : bench.sizes() ) {
+			const string s = makeInput(a, n);
+			const string_view sv = s;
+			const string absent = absentNeedle(s), end = endNeedle(s);
+			bench.runEach("findSubStr", "sv/" + a + "/absent", n, [&] { return strTools::findSubStr(sv, absent); });
+			bench.runEach("findSubStr", "sv/" + a + "/end", n, [&] { return strTools::findSubStr(sv, end); });
+			bench.runEach("replaceStr", "sv/" + a + "/absent", n, [&] { return strTools::replaceStr(sv, absent, replacement); });
+			bench.runEach("replaceStr", "sv/" + a + "/end", n, [&] { return strTools::replaceStr(sv, end, replacement); });
+		}
+	}
+
+	std::pmr::unsynchronized_pool_resource pool;
+	for( const uint64_t n : bench.sizes() ) {
+		const string run(n, 'a');
+		const string partial = string(std::min<uint64_t>(n, 16) - 1, 'a') + "b";
+		bench.runEach("findSubStr", "sv/repeat/partial", n, [&] { return strTools::findSubStr(run, partial); });
+
+		const string s = makeInput("text", n);
+		const string_view sv = s;
+		const string end = endNeedle(s);
+		smallStr r;
+		bench.runEach("findSubStr", "cstr/text/end", n, [&] { return strTools::findSubStr(s.c_str(), end.c_str()); });
+		bench.runEach("replaceStr", "small/text/end", n, [&] { strTools::replaceStr(r, sv, end, replacement); return r.data(); });
+		bench.runEach("replaceStr", "pmr/text/end", n, [&] { return strTools::replaceStr(sv, end, replacement, &pool); });
+		bench.runEach("replaceStr", "cstr/text/end", n, [&] {
+			return strTools::replaceStr(s.c_str(), end.c_str(), replacement.c_str());
+		});
+	}
+}
+
+/**
+ * @brief splitStr into words (' ', every ~6 bytes), lines ('\n', every 80) and
+ * nothing ('\t' never occurs).
+ */
+static void benchSplit(__StrBench& bench) {
+	static const char* const densities[] = { "words", "lines", "none" };
+	static const char delims[] = { ' ', '\n', '\t' };
+	for( const uint64_t n : bench.sizes() ) {
+		const string s = makeInput("text", n);
+		const string_view sv = s;
+		const sharedStr shared = strUtil::makeSharedStr(s.c_str());
+		const strSlice slice(shared);
+		for( int d = 0; d < 3; ++d ) {
+			const char delim = delims[d];
+			bench.runEach("splitStr", string("sv/text/") + densities[d], n, [&] { return strTools::splitStr(sv, delim); });
+			bench.runEach("splitStr", string("slice/text/") + densities[d], n, [&] { return strTools::splitStr(slice, delim); });
+		}
+	}
+}
+
+/**
+ * @brief ASCII case conversion, translation and case-insensitive comparison.
+ *
+ * The in-place cases convert the same buffer over and over, so after the
+ * first pass they measure the scan of already converted text. "bytewise" is
+ * the former per-byte path, `toSomething` with `tolower`/`toupper`: the
+ * baseline of the SIMD "cstr-inplace" cases.
+ */
+static void benchCase(__StrBench& bench) {
+	static const char* const caseAlphabets[] = { "binary", "text", "utf8" };
+	const strTranslator rot13 = strTranslator()
+		.map("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ", "nopqrstuvwxyzabcdefghijklmNOPQRSTUVWXYZABCDEFGHIJKLM");
+	const strTranslator strip = strTranslator().remove(" \n.,;:!?");
+	for( const uint64_t n : bench.sizes() ) {
+		for( const char* alphabet : caseAlphabets ) {
+			const string a = alphabet;
+			const string s = makeInput(a, n);
+			string buffer = s;
+			char* const b = buffer.data();
+			bench.runEach("toLower", "inplace/" + a, n, [&] { strUtil::toLower(b, n); return b; });
+			bench.runEach("toUpper", "inplace/" + a, n, [&] { strUtil::toUpper(b, n); return b; });
+			bench.runEach("toLower", "cstr-inplace/" + a, n, [&] { strUtil::toLower(b); return b; });
+			bench.runEach("toUpper", "cstr-inplace/" + a, n, [&] { strUtil::toUpper(b); return b; });
+			bench.runEach("toLower", "bytewise/" + a, n, [&] { __StrUtilExtra.toSomething(b, tolower); return b; });
+			bench.runEach("toUpper", "bytewise/" + a, n, [&] { __StrUtilExtra.toSomething(b, toupper); return b; });
+			bench.runEach("toLower", "copy/" + a, n, [&] { return strUtil::toLower(s.c_str()); });
+			bench.runEach("toUpper", "copy/" + a, n, [&] { return strUtil::toUpper(s.c_str()); });
+		}
+
+		const string s = makeInput("text", n);
+		string buffer = s;
+		bench.runEach("strTranslator::apply", "rot13/text", n, [&] { return rot13.apply(buffer.data(), n); });
+		bench.runEach("strTranslator::translate", "rot13/text", n, [&] { return rot13.translate(s); });
+		bench.runEach("strTranslator::translate", "strip/text", n, [&] { return strip.translate(s); });
+
+		const uniqueStr upper = strUtil::toUpper(s.c_str());
+		const string_view other(upper.get(), n);
+		bench.runEach("iequals", "text", n, [&] { return strUtil::iequals(s, other); });
+		bench.runEach("icompare", "text", n, [&] { return strUtil::icompare(s, other); });
+		bench.runEach("ihash", "text", n, [&] { return strUtil::ihash(s); });
+	}
+}
+
+/**
+ * @brief UTF-8 case mapping and case-insensitive search.
+ *
+ * "text" is plain ASCII and takes the ASCII fast paths; "utf8" does not.
+ */
+static void benchUtf8(__StrBench& bench) {
+	static const char* const utf8Alphabets[] = { "text", "utf8" };
+	for( const uint64_t n : bench.sizes() ) {
+		for( const char* alphabet : utf8Alphabets ) {
+			const string a = alphabet;
+			const string s = makeInput(a, n);
+			bench.runEach("utf8ToLower", a, n, [&] { return strUtil::utf8ToLower(s); });
+			bench.runEach("utf8ToUpper", a, n, [&] { return strUtil::utf8ToUpper(s); });
+			bench.runEach("utf8Fold", a, n, [&] { return strUtil::utf8Fold(s); });
+
+			// Search for the tail in the other case, so folding is exercised.
+			const uniqueStr folded = strUtil::utf8ToUpper(endNeedle(s));
+			const string end = folded.get();
+			const string absent = absentNeedle(s);
+			bench.runEach("findSubStrUtf8", a + "/end", n, [&] { return strTools::findSubStrUtf8(s, end); });
+			bench.runEach("findSubStrUtf8", a + "/absent", n, [&] { return strTools::findSubStrUtf8(s, absent); });
+		}
+	}
+}
+
+/**
+ * @brief The smart string factories of strUtil.
+ */
+static void benchMake(__StrBench& bench) {
+	for( const uint64_t n : bench.sizes() ) {
+		const string s = makeInput("text", n);
+		const char* const cs = s.c_str();
+		bench.runEach("makeUniqueStr", "text", n, [&] { return strUtil::makeUniqueStr(cs); });
+		bench.runEach("makeSharedStr", "text", n, [&] { return strUtil::makeSharedStr(cs); });
+		bench.runEach("makeSmartStr", "text", n, [&] { return strUtil::makeSmartStr<uniqueStr>(cs); });
+		// These only allocate; the size is part of the id, not a byte rate.
+		bench.runEach("makeSmartPtrArray", __strBenchSize(n), 0, [&] { return strUtil::makeSmartPtrArray<uniqueStr>(n); });
+		bench.runEach("makePooledStr", __strBenchSize(n), 0, [&] { return strUtil::makePooledStr(n); });
+	}
+}
+
+/**
+ * @brief Interning, allocation and logging from 1 to `maxThreads` threads at once.
+ *
+ * internStr "copy" is the baseline of "hit": one heap copy per lookup. "hit"
+ * also reports the bytes the pool stores against the bytes the copies of
+ * its lookups would take.
+ *
+ * concatStr "request" builds 32 results of 48 bytes (past the inline
+ * capacity of `smallStr`) that live until the request ends, then frees them
+ * all: "global" on the global allocator, "monotonic" in a per-thread arena
+ * released after each request, and "syncpool" in one shared
+ * `synchronized_pool_resource`. ns/op is per result.
+ */
+static void benchThreads(__StrBench& bench) {
+	std::vector<string> keys;
+	for( int i = 0; i < 4096; ++i ) keys.push_back("header-field-" + std::to_string(i * 7919));
+	const auto nullSink = std::make_shared<__StrLogNullSink>();
+
+	constexpr uint64_t requestSize = 32;
+	const string left = makeInput("text", 24), right = makeInput("text", 24, 2);
+	std::pmr::synchronized_pool_resource sharedPool;
+
+	for( const unsigned threads : bench.threadCounts() ) {
+		__StrBenchCrew crew(threads);
+		const uint64_t requested = __strInternPool.requestedBytes();
+		__StrBenchResult* hit = bench.runThreads("internStr", "hit", crew, [&](const unsigned t, const uint64_t k) {
+			for( uint64_t i = 0; i < k; ++i ) __strBenchKeep(strUtil::internStr(keys[( t * 1031 + i ) % keys.size()]));
+		});
+		if( hit ) {
+			// The pool holds only the keys, so its total is what these lookups cost.
+			const double stored = static_cast<double>( __strInternPool.storedBytes() );
+			const double copies = static_cast<double>( __strInternPool.requestedBytes() - requested );
+			bench.note(hit, "stored_bytes", stored);
+			bench.note(hit, "requested_bytes", copies);
+			bench.note(hit, "saved_pct", copies > 0 ? 100 * ( 1 - stored / copies ) : 0);
+		}
+		bench.runThreads("internStr", "copy", crew, [&](const unsigned t, const uint64_t k) {
+			for( uint64_t i = 0; i < k; ++i ) __strBenchKeep(strUtil::makeUniqueStr(keys[( t * 1031 + i ) % keys.size()].c_str()));
+		});
+
+		bench.runThreads("concatStr", "request/global", crew, [&](unsigned, const uint64_t k) {
+			std::vector<uniqueStr> live;
+			live.reserve(requestSize);
+			for( uint64_t i = 0; i < k; ++i ) {
+				for( uint64_t j = 0; j < requestSize; ++j ) live.push_back(strTools::concatStr(left, right));
+				live.clear();
+			}
+		}, requestSize);
+		bench.runThreads("concatStr", "request/monotonic", crew, [&](unsigned, const uint64_t k) {
+			alignas(std::max_align_t) std::byte buffer[4096];
+			std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer));
+			std::vector<smallStr> live;
+			live.reserve(requestSize);
+			for( uint64_t i = 0; i < k; ++i ) {
+				for( uint64_t j = 0; j < requestSize; ++j ) live.push_back(strTools::concatStr(left, right, &arena));
+				live.clear();
+				arena.release();
+			}
+		}, requestSize);
+		bench.runThreads("concatStr", "request/syncpool", crew, [&](unsigned, const uint64_t k) {
+			std::vector<smallStr> live;
+			live.reserve(requestSize);
+			for( uint64_t i = 0; i < k; ++i ) {
+				for( uint64_t j = 0; j < requestSize; ++j ) live.push_back(strTools::concatStr(left, right, &sharedPool));
+				live.clear();
+			}
+		}, requestSize);
+
+		// Records go to a sink that drops them: this measures the logger, not the disk.
+		const bool wasEnabled = __strToolsLogger.loggerStatus();
+		if( !wasEnabled ) __strToolsLogger.toggleLogger();
+		__strToolsLogger.addSink(nullSink);
+		const auto log = [](const unsigned t, const uint64_t k) {
+			for( uint64_t i = 0; i < k; ++i ) _STRLOGF("bench thread {} record {}", t, i);
+		};
+		bench.runThreads("_STRLOGF", "sync", crew, log);
+		__strToolsLogger.setAsync(true, 1 << 16, __StrLogOverflow::BLOCK);
+		bench.runThreads("_STRLOGF", "async", crew, log);
+		__strToolsLogger.setAsync(false);
+		__strToolsLogger.removeSink(nullSink);
+		if( !wasEnabled ) __strToolsLogger.toggleLogger();
+	}
+}
+
+int main(int argc, char** argv) {
+	__StrBenchOptions options;
+	if( !options.parse(argc, argv, std::cerr) ) return 2;
+
+	// With --json=- stdout carries only the JSON, so the table goes to stderr.
+	const bool jsonToStdout = options.jsonPath == "-" && !options.list;
+	__StrBench bench(options, jsonToStdout ? std::cerr : std::cout);
+	if( !__StrBench::optimized() ) std::cerr << "warning: unoptimized build; configure with -DCMAKE_BUILD_TYPE=Release\n";
+	benchBuild(bench);
+	benchSearch(bench);
+	benchSplit(bench);
+	benchCase(bench);
+	benchUtf8(bench);
+	benchMake(bench);
+	benchThreads(bench);
+
+	if( !options.jsonPath.empty() && !options.list ) {
+		if( jsonToStdout ) {
+			bench.writeJson(std::cout);
+		} else {
+			std::ofstream json(options.jsonPath, std::ios::out | std::ios::trunc);
+			if( !json.is_open() ) {
+				std::cerr << "Failed to open " << options.jsonPath << "\n";
+				return 1;
+			}
+			bench.writeJson(json);
+		}
+	}
+	return 0;
+}
@@ -146,6 +146,7 @@ using std::unique_ptr, std::make_unique;
 int main() {
 	bool mainLoop = true;
 	// __strToolsLogger.toggleLogger(); // Uncomment this for debbugging.
+	// __strToolsLogger.setConsoleEcho(true); // And this to see the records in the terminal.
 	__strToolsLogger.setLogFile("./src/_dump.log");
 	// Value to be captured from the CLI.
 	int32_t selector = 0;
@@ -175,13 +176,16 @@ int main() {
 
 		switch( selector ) {
 		default: extraMsg = "Value is out of bounds!"; _logger(extraMsg, __StrToolsLogLvl::WARNING); break;
-		case -1: __strToolsLogger.toggleLogger(); break;
+		case -1: // Toggle the logger, echoing records to the terminal while it is on.
+			__strToolsLogger.toggleLogger();
+			__strToolsLogger.setConsoleEcho(__strToolsLogger.loggerStatus());
+			break;
 		case 0: mainLoop = false; break;
 		case 1: // Calculate the length of a string.
 		{
 			_logger("case 1 started.");
 			// Initialize a smart pointer to handle the string lenght.
-			uniqueStr strLen(new char[_STRING_MAX_SIZE]);
+			pooledStr strLen = strUtil::makePooledStr(_STRING_MAX_SIZE);
 
 			cout << "Enter a string (type '/exit' to quit).\n" << flush;
 			cin.ignore();
@@ -208,14 +212,14 @@ int main() {
 		{
 			_logger("case 2 started.");
 			// Array values to be modified by the user.
-			std::array<uniqueStr, 3> stringVals = {
-				strUtil::makeSmartPtrArray<uniqueStr>(_STRING_MAX_SIZE),
-				strUtil::makeSmartPtrArray<uniqueStr>(_STRING_MAX_SIZE),
-				strUtil::makeSmartPtrArray<uniqueStr>(_STRING_MAX_SIZE),
+			std::array<pooledStr, 3> stringVals = {
+				strUtil::makePooledStr(_STRING_MAX_SIZE),
+				strUtil::makePooledStr(_STRING_MAX_SIZE),
+				strUtil::makePooledStr(_STRING_MAX_SIZE),
 			};
 
 			// This helper allows the array values to be modified easily.
-			uniqueStr strHelper(new char[_STRING_MAX_SIZE]);
+			pooledStr strHelper = strUtil::makePooledStr(_STRING_MAX_SIZE);
 			bool exitWasCaptured = false;
 
 			cout <<
@@ -254,9 +258,9 @@ int main() {
 		case 3: // Search for a character in a string.
 		{
 			_logger("case 3 started.");
-			std::array<uniqueStr, 2> stringVals = {
-				strUtil::makeSmartPtrArray<uniqueStr>(_STRING_MAX_SIZE),
-				strUtil::makeSmartPtrArray<uniqueStr>(_STRING_MAX_SIZE),
+			std::array<pooledStr, 2> stringVals = {
+				strUtil::makePooledStr(_STRING_MAX_SIZE),
+				strUtil::makePooledStr(_STRING_MAX_SIZE),
 			};
 
 			// This will return true if the input is '/exit'.
@@ -331,8 +335,8 @@ int main() {
 				return distr(gen);
 				};
 
-			uniqueStr originalString(new char[_STRING_MAX_SIZE]);
-			uniqueStr subStrFromOriginal(new char[_STRING_MAX_SIZE]);
+			pooledStr originalString = strUtil::makePooledStr(_STRING_MAX_SIZE);
+			uniqueStr subStrFromOriginal;
 			uint64_t strLen = 0ull, strLowIndex = 0ull, strUppIndex = 0ull;
 
 			cout <<
@@ -9,7 +9,23 @@
  *
  */
 
+#include "stralloc.hh"
+#include "stricase.hh"
+#include "strintern.hh"
+#include "strlogbin.hh"
 #include "strlogger.hh"
+#include "strloglimit.hh"
+#include "strlogsink.hh"
+#include "strpool.hh"
+#include "strprofile.hh"
+#include "strrc.hh"
+#include "strsimd.hh"
+#include "strslice.hh"
+#include "strsmall.hh"
 #include "strtools.hh"
+#include "strtrace.hh"
+#include "strtranslate.hh"
+#include "strunicase.hh"
+#include "strutf8.hh"
 #include "strutil.hh"
 #include "strutilhelper.hh"
@@ -0,0 +1,364 @@
+/**
+ * @file stralloc.hh
+ * @author Ian Hylton
+ * @brief Optional allocation accounting per strTools operation and per thread.
+ * @version 1.0.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) zperk 2024
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <new>
+#include <ostream>
+#include <string>
+#include <vector>
+
+using std::string;
+
+/**
+ * @brief Allocation counts of one operation or thread.
+ */
+struct __StrAllocStats {
+	string name;
+	uint64_t allocations = 0;
+	uint64_t frees = 0;
+	uint64_t bytes = 0;
+	/// @brief Bytes allocated and not freed yet.
+	int64_t liveBytes = 0;
+	/// @brief Highest `liveBytes` seen.
+	int64_t peakBytes = 0;
+};
+
+/**
+ * @class __StrAllocTracker
+ * @brief Counts heap allocations, bytes and live bytes per operation and thread.
+ *
+ * With `STRTOOLS_TRACK_ALLOC` defined, this header replaces the global
+ * `operator new`/`operator delete`. Every allocation is charged to the
+ * innermost strTools operation running on the calling thread (the one whose
+ * `_STROP` is active), or to "(outside strTools)", and to the thread that
+ * made it. A small header in front of each block remembers both, so a block
+ * freed on another thread is still credited to the right operation.
+ *
+ * Like the logger, the replacement functions are defined in this header, so
+ * the library must be included in only one translation unit of the program.
+ *
+ * @note Example usage:
+ * @code
+ * // g++ -DSTRTOOLS_TRACK_ALLOC ...
+ * __StrAllocTracker::reset();
+ * for( int i = 0; i < 1000; ++i ) strTools::concatStr("Hello, ", "World!");
+ * __StrAllocTracker::dumpText(std::cout); // concatStr: 1000 allocations, 14000 bytes
+ * @endcode
+ */
+class __StrAllocTracker {
+public:
+	/// @brief Operation slots; the last one collects allocations outside any operation.
+	static constexpr size_t maxOps = 128;
+	/// @brief Thread slots; threads beyond the last one share it.
+	static constexpr size_t maxThreads = 256;
+
+private:
+	struct alignas(64) Slot {
+		std::atomic<uint64_t> allocations { 0 };
+		std::atomic<uint64_t> frees { 0 };
+		std::atomic<uint64_t> bytes { 0 };
+		std::atomic<int64_t> live { 0 };
+		std::atomic<int64_t> peak { 0 };
+	};
+
+	/// @brief Written in front of every tracked block; keeps the block 16-byte aligned.
+	struct alignas(16) Header {
+		uint64_t size;
+		uint32_t op;
+		uint32_t thread;
+	};
+
+	static Slot* opSlots() {
+		static Slot slots[maxOps + 1];
+		return slots;
+	}
+
+	static Slot* threadSlots() {
+		static Slot slots[maxThreads];
+		return slots;
+	}
+
+	static std::atomic<const char*>* opNames() {
+		static std::atomic<const char*> names[maxOps + 1] = {};
+		return names;
+	}
+
+	static std::atomic<uint32_t>& threadCount() {
+		static std::atomic<uint32_t> n { 0 };
+		return n;
+	}
+
+	/// @brief The calling thread's innermost operation (`maxOps` outside any).
+	static uint32_t& currentOp() noexcept {
+		static thread_local uint32_t op = maxOps;
+		return op;
+	}
+
+	static uint32_t threadSlot() noexcept {
+		static thread_local uint32_t slot = UINT32_MAX;
+		if( slot == UINT32_MAX ) {
+			const uint32_t n = threadCount().fetch_add(1, std::memory_order_relaxed);
+			slot = n < maxThreads ? n : static_cast<uint32_t>( maxThreads - 1 );
+		}
+		return slot;
+	}
+
+	static void charge(Slot& s, const uint64_t size) noexcept {
+		s.allocations.fetch_add(1, std::memory_order_relaxed);
+		s.bytes.fetch_add(size, std::memory_order_relaxed);
+		const int64_t live = s.live.fetch_add(static_cast<int64_t>( size ), std::memory_order_relaxed) + static_cast<int64_t>( size );
+		int64_t peak = s.peak.load(std::memory_order_relaxed);
+		while( live > peak && !s.peak.compare_exchange_weak(peak, live, std::memory_order_relaxed) ) {}
+	}
+
+	static void credit(Slot& s, const uint64_t size) noexcept {
+		s.frees.fetch_add(1, std::memory_order_relaxed);
+		s.live.fetch_sub(static_cast<int64_t>( size ), std::memory_order_relaxed);
+	}
+
+	static __StrAllocStats read(const Slot& s) noexcept {
+		__StrAllocStats out;
+		out.allocations = s.allocations.load(std::memory_order_relaxed);
+		out.frees = s.frees.load(std::memory_order_relaxed);
+		out.bytes = s.bytes.load(std::memory_order_relaxed);
+		out.liveBytes = s.live.load(std::memory_order_relaxed);
+		out.peakBytes = s.peak.load(std::memory_order_relaxed);
+		return out;
+	}
+
+	static void writeText(std::ostream& out, const std::vector<__StrAllocStats>& rows) {
+		for( const auto& r : rows ) {
+			out << std::left << std::setw(22) << r.name << std::right << std::setw(12) << r.allocations
+				<< std::setw(12) << r.frees << std::setw(14) << r.bytes
+				<< std::setw(12) << r.liveBytes << std::setw(12) << r.peakBytes << "\n";
+		}
+	}
+
+	static void writeJson(std::ostream& out, const std::vector<__StrAllocStats>& rows) {
+		out << "[";
+		for( size_t i = 0; i < rows.size(); ++i ) {
+			const auto& r = rows[i];
+			out << ( i ? "," : "" ) << "\n{\"name\":\"" << r.name << "\",\"allocations\":" << r.allocations
+				<< ",\"frees\":" << r.frees << ",\"bytes\":" << r.bytes
+				<< ",\"live_bytes\":" << r.liveBytes << ",\"peak_bytes\":" << r.peakBytes << "}";
+		}
+		out << "\n]";
+	}
+
+public:
+	/**
+	 * @brief Allocates a tracked block (used by the replacement `operator new`).
+	 *
+	 * @return The block, or `nullptr` if `malloc` failed.
+	 */
+	static void* allocate(const size_t size) noexcept {
+		auto* h = static_cast<Header*>( std::malloc(sizeof(Header) + size) );
+		if( !h ) return nullptr;
+		h->size = size;
+		h->op = currentOp();
+		h->thread = threadSlot();
+		charge(opSlots()[h->op], size);
+		charge(threadSlots()[h->thread], size);
+		return h + 1;
+	}
+
+	/**
+	 * @brief Frees a block from `allocate` (used by the replacement `operator delete`).
+	 */
+	static void release(void* p) noexcept {
+		if( !p ) return;
+		Header* h = static_cast<Header*>( p ) - 1;
+		credit(opSlots()[h->op], h->size);
+		credit(threadSlots()[h->thread], h->size);
+		std::free(h);
+	}
+
+	/**
+	 * @brief Makes `op` the calling thread's current operation (see `__StrAllocScope`).
+	 *
+	 * @return The previous operation, to restore later.
+	 */
+	static uint32_t enter(const uint32_t op, const char* name) noexcept {
+		const uint32_t id = op < maxOps ? op : static_cast<uint32_t>( maxOps );
+		if( id < maxOps && !opNames()[id].load(std::memory_order_relaxed) ) opNames()[id].store(name, std::memory_order_relaxed);
+		const uint32_t previous = currentOp();
+		currentOp() = id;
+		return previous;
+	}
+
+	/**
+	 * @brief Restores the operation `enter` replaced.
+	 */
+	static void leave(const uint32_t previous) noexcept {
+		currentOp() = previous;
+	}
+
+	/**
+	 * @brief Gets the counts of every operation that allocated, plus "(outside strTools)".
+	 */
+	static std::vector<__StrAllocStats> byOperation() {
+		std::vector<__StrAllocStats> rows;
+		for( size_t i = 0; i <= maxOps; ++i ) {
+			__StrAllocStats s = read(opSlots()[i]);
+			if( !s.allocations && !s.frees ) continue;
+			const char* name = i < maxOps ? opNames()[i].load(std::memory_order_relaxed) : "(outside strTools)";
+			s.name = name ? name : "?";
+			rows.push_back(std::move(s));
+		}
+		return rows;
+	}
+
+	/**
+	 * @brief Gets the counts of every thread that allocated, named "thread N"
+	 * in the order the threads first allocated.
+	 */
+	static std::vector<__StrAllocStats> byThread() {
+		std::vector<__StrAllocStats> rows;
+		const size_t n = threadCount().load(std::memory_order_relaxed);
+		for( size_t i = 0; i < n && i < maxThreads; ++i ) {
+			__StrAllocStats s = read(threadSlots()[i]);
+			s.name = "thread " + std::to_string(i);
+			rows.push_back(std::move(s));
+		}
+		return rows;
+	}
+
+	/**
+	 * @brief Gets the number of allocations made so far by every thread.
+	 *
+	 * Unlike `byThread`, this allocates nothing itself, so it can bracket a
+	 * measured block of code.
+	 */
+	static uint64_t allocationCount() noexcept {
+		uint64_t n = 0;
+		for( size_t i = 0; i < maxThreads; ++i ) n += threadSlots()[i].allocations.load(std::memory_order_relaxed);
+		return n;
+	}
+
+	/**
+	 * @brief Zeroes the counters.
+	 *
+	 * Live and peak bytes restart from zero, so blocks allocated earlier and
+	 * freed later make `liveBytes` negative for their operation.
+	 */
+	static void reset() noexcept {
+		auto clear = [](Slot& s) {
+			s.allocations.store(0, std::memory_order_relaxed);
+			s.frees.store(0, std::memory_order_relaxed);
+			s.bytes.store(0, std::memory_order_relaxed);
+			s.live.store(0, std::memory_order_relaxed);
+			s.peak.store(0, std::memory_order_relaxed);
+		};
+		for( size_t i = 0; i <= maxOps; ++i ) clear(opSlots()[i]);
+		for( size_t i = 0; i < maxThreads; ++i ) clear(threadSlots()[i]);
+	}
+
+	/**
+	 * @brief Writes the per-operation and per-thread counts as tables.
+	 */
+	static void dumpText(std::ostream& out) {
+		out << std::left << std::setw(22) << "operation" << std::right << std::setw(12) << "allocs"
+			<< std::setw(12) << "frees" << std::setw(14) << "bytes" << std::setw(12) << "live" << std::setw(12) << "peak" << "\n";
+		writeText(out, byOperation());
+		out << "\n";
+		writeText(out, byThread());
+	}
+
+	/**
+	 * @brief Writes the per-operation and per-thread counts as JSON.
+	 */
+	static void dumpJson(std::ostream& out) {
+		out << "{\"operations\":";
+		writeJson(out, byOperation());
+		out << ",\"threads\":";
+		writeJson(out, byThread());
+		out << "}\n";
+	}
+};
+
+/**
+ * @class __StrAllocScope
+ * @brief Charges allocations in the enclosing scope to one operation.
+ */
+class __StrAllocScope {
+private:
+	uint32_t previous;
+
+public:
+	__StrAllocScope(const uint32_t op, const char* name) noexcept : previous(__StrAllocTracker::enter(op, name)) {}
+
+	~__StrAllocScope() {
+		__StrAllocTracker::leave(previous);
+	}
+
+	__StrAllocScope(const __StrAllocScope&) = delete;
+	__StrAllocScope& operator=(const __StrAllocScope&) = delete;
+};
+
+#ifdef STRTOOLS_TRACK_ALLOC
+// Replacement allocation functions. The over-aligned forms are left alone:
+// they have their own matching deallocation functions.
+
+void* operator new(std::size_t size) {
+	for( ;;) {
+		if( void* p = __StrAllocTracker::allocate(size) ) return p;
+		std::new_handler handler = std::get_new_handler();
+		if( !handler ) throw std::bad_alloc();
+		handler();
+	}
+}
+
+void* operator new[](std::size_t size) {
+	return ::operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+	try {
+		return ::operator new(size);
+	} catch( ... ) {
+		return nullptr;
+	}
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+	return ::operator new(size, std::nothrow);
+}
+
+void operator delete(void* p) noexcept {
+	__StrAllocTracker::release(p);
+}
+
+void operator delete[](void* p) noexcept {
+	__StrAllocTracker::release(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+	__StrAllocTracker::release(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+	__StrAllocTracker::release(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept {
+	__StrAllocTracker::release(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept {
+	__StrAllocTracker::release(p);
+}
+#endif
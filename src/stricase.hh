@@ -0,0 +1,137 @@
+/**
+ * @file stricase.hh
+ * @author Ian Hylton
+ * @brief Case-insensitive comparison and hashing without copies.
+ * @version 1.0.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) zperk 2024
+ *
+ */
+
+#pragma once
+
+#include "strsimd.hh"
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+using std::string_view;
+
+namespace strUtil {
+	/**
+	 * @brief Checks whether two strings are equal, ignoring ASCII case.
+	 *
+	 * Unlike comparing two `toLower` copies, nothing is allocated: both
+	 * strings are folded in registers 16-32 bytes at a time. Bytes above 0x7F
+	 * must match exactly.
+	 *
+	 * @param a The first string.
+	 * @param b The second string.
+	 * @return `true` if the strings are equal ignoring case.
+	 *
+	 * @note Example usage:
+	 * @code
+	 * bool same = strUtil::iequals("Content-Type", "content-type"); // true
+	 * @endcode
+	 */
+	static bool iequals(string_view a, string_view b) noexcept {
+		return a.size() == b.size() && __StrSimd::foldMismatch(a.data(), b.data(), a.size()) == a.size();
+	}
+
+	/**
+	 * @brief Compares two strings lexicographically, ignoring ASCII case.
+	 *
+	 * Characters are compared as unsigned bytes after lowercasing, like
+	 * `strcasecmp` in the C locale.
+	 *
+	 * @param a The first string.
+	 * @param b The second string.
+	 * @return A negative value if `a` sorts first, 0 if equal, a positive value otherwise.
+	 */
+	static int icompare(string_view a, string_view b) noexcept {
+		const size_t n = a.size() < b.size() ? a.size() : b.size();
+		const size_t i = __StrSimd::foldMismatch(a.data(), b.data(), n);
+		if( i < n ) {
+			return static_cast<int>( __StrSimd::foldWord((unsigned char) a[i]) )
+				- static_cast<int>( __StrSimd::foldWord((unsigned char) b[i]) );
+		}
+		return a.size() < b.size() ? -1 : a.size() > b.size() ? 1 : 0;
+	}
+
+	/**
+	 * @brief Hashes a string so that strings equal ignoring ASCII case collide.
+	 *
+	 * Eight bytes are folded and mixed at a time, and the result goes through
+	 * a 64-bit finalizer so every input bit affects every output bit.
+	 *
+	 * @param s The string to hash.
+	 * @return The hash; `ihash(a) == ihash(b)` whenever `iequals(a, b)`.
+	 */
+	static size_t ihash(string_view s) noexcept {
+		const uint64_t k = 0xBF58476D1CE4E5B9ull;
+		uint64_t h = 0x9E3779B97F4A7C15ull ^ s.size();
+		size_t i = 0;
+		for( ; i + 8 <= s.size(); i += 8 ) {
+			uint64_t w;
+			memcpy(&w, s.data() + i, 8);
+			h = ( h ^ __StrSimd::foldWord(w) ) * k;
+			h ^= h >> 31;
+		}
+		if( i < s.size() ) {
+			uint64_t w = 0;
+			memcpy(&w, s.data() + i, s.size() - i);
+			h = ( h ^ __StrSimd::foldWord(w) ) * k;
+		}
+		h ^= h >> 30;
+		h *= k;
+		h ^= h >> 27;
+		h *= 0x94D049BB133111EBull;
+		h ^= h >> 31;
+		return static_cast<size_t>( h );
+	}
+
+	/**
+	 * @brief Case-insensitive hasher for unordered containers.
+	 *
+	 * Together with `iEqual` it is transparent, so a container keyed by
+	 * `std::string` can be searched with a `const char*` or `string_view`
+	 * without building a key.
+	 *
+	 * @note Example usage:
+	 * @code
+	 * std::unordered_map<std::string, int, strUtil::iHash, strUtil::iEqual> headers;
+	 * headers["Content-Length"] = 42;
+	 * auto it = headers.find("content-length"); // no allocation
+	 * @endcode
+	 */
+	struct iHash {
+		using is_transparent = void;
+
+		size_t operator()(string_view s) const noexcept {
+			return ihash(s);
+		}
+	};
+
+	/**
+	 * @brief Case-insensitive equality for unordered containers.
+	 */
+	struct iEqual {
+		using is_transparent = void;
+
+		bool operator()(string_view a, string_view b) const noexcept {
+			return iequals(a, b);
+		}
+	};
+
+	/**
+	 * @brief Case-insensitive ordering for `std::map` and `std::set`.
+	 */
+	struct iLess {
+		using is_transparent = void;
+
+		bool operator()(string_view a, string_view b) const noexcept {
+			return icompare(a, b) < 0;
+		}
+	};
+}
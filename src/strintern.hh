@@ -0,0 +1,279 @@
+/**
+ * @file strintern.hh
+ * @author Ian Hylton
+ * @brief Thread-safe string interning.
+ * @version 1.0.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) zperk 2024
+ *
+ */
+
+#pragma once
+
+#include "strlogger.hh"
+#include "strutilhelper.hh"
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory_resource>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_set>
+
+using std::string_view;
+
+/**
+ * @brief The one address every empty `internedStr` points to.
+ *
+ * Default-constructed handles and `intern("")` both use it, so an empty
+ * handle compares equal to any other empty handle.
+ */
+inline constexpr char __strInternEmpty[1] = "";
+
+class __StrInternPool;
+
+/**
+ * @class internedStr
+ * @brief A handle to a string stored once in the intern pool.
+ *
+ * Equal strings interned through the same pool always get the same handle,
+ * so comparing two handles is a single pointer comparison. The characters
+ * are null-terminated and stay valid for the lifetime of the pool. A
+ * default-constructed handle is the empty string.
+ */
+class internedStr {
+private:
+	const char* ptr;
+	uint64_t length;
+
+	// Only the pool hands out handles, so equal strings share one address.
+	friend class __StrInternPool;
+	internedStr(const char* p, const uint64_t n) noexcept : ptr(p), length(n) {}
+
+public:
+	internedStr() noexcept : ptr(__strInternEmpty), length(0) {}
+
+	const char* c_str() const noexcept {
+		return ptr;
+	}
+
+	const char* data() const noexcept {
+		return ptr;
+	}
+
+	uint64_t size() const noexcept {
+		return length;
+	}
+
+	bool empty() const noexcept {
+		return length == 0;
+	}
+
+	string_view view() const noexcept {
+		return string_view(ptr, length);
+	}
+
+	operator string_view() const noexcept {
+		return view();
+	}
+
+	/**
+	 * @brief Compares two handles in O(1).
+	 */
+	bool operator==(const internedStr& other) const noexcept {
+		return ptr == other.ptr;
+	}
+
+	bool operator!=(const internedStr& other) const noexcept {
+		return ptr != other.ptr;
+	}
+};
+
+/**
+ * @brief Hashes an `internedStr` by address, which is unique per string.
+ */
+namespace std {
+	template<>
+	struct hash<internedStr> {
+		size_t operator()(const internedStr& s) const noexcept {
+			return hash<const char*>()( s.data() );
+		}
+	};
+}
+
+/**
+ * @class __StrInternPool
+ * @brief A sharded hash set of strings over append-only arenas.
+ *
+ * A string is hashed once. The hash selects one of `shardCount` shards, and
+ * it is stored next to the string so the shard's table never rehashes
+ * characters. Lookups of known strings only take the shard's shared lock,
+ * so readers on different threads do not block each other. A new string is
+ * copied once into the shard's monotonic arena, and its address never changes
+ * afterwards. The empty string is not stored; it maps to `__strInternEmpty`.
+ *
+ * The usage counters are kept per thread slot, not per shard, so a lookup
+ * never writes to a cache line that other threads read.
+ */
+class __StrInternPool {
+public:
+	static constexpr size_t shardCount = 64;
+
+private:
+	struct Key {
+		string_view s;
+		size_t hash;
+
+		bool operator==(const Key& other) const noexcept {
+			return s == other.s;
+		}
+	};
+
+	struct KeyHash {
+		size_t operator()(const Key& k) const noexcept {
+			return k.hash;
+		}
+	};
+
+	struct alignas(64) Shard {
+		mutable std::shared_mutex lock;
+		std::pmr::monotonic_buffer_resource arena;
+		std::unordered_set<Key, KeyHash> table;
+		uint64_t storedBytes = 0;
+	};
+
+	/// @brief Usage counters of the threads assigned to one slot.
+	struct alignas(64) Counters {
+		std::atomic<uint64_t> lookups { 0 };
+		std::atomic<uint64_t> requestedBytes { 0 };
+	};
+
+	static constexpr size_t counterSlots = 64;
+
+	Shard shards[shardCount];
+	Counters counters[counterSlots];
+
+	/**
+	 * @brief Gets the calling thread's counter slot.
+	 *
+	 * Threads get consecutive slots, so up to `counterSlots` threads never
+	 * share one.
+	 */
+	static size_t counterSlot() noexcept {
+		static std::atomic<size_t> next { 0 };
+		thread_local const size_t slot = next.fetch_add(1, std::memory_order_relaxed) % counterSlots;
+		return slot;
+	}
+
+	Shard& shardOf(const size_t hash) noexcept {
+		// The low bits feed the table's buckets, so pick the shard from the top.
+		return shards[( hash >> ( sizeof(size_t) * 4 ) ) % shardCount];
+	}
+
+public:
+	__StrInternPool() = default;
+	__StrInternPool(const __StrInternPool&) = delete;
+	__StrInternPool& operator=(const __StrInternPool&) = delete;
+
+	/**
+	 * @brief Interns a string.
+	 *
+	 * @param s The characters to intern. Embedded NULs are allowed.
+	 * @return The handle shared by every string equal to `s`.
+	 */
+	internedStr intern(string_view s) {
+		Counters& c = counters[counterSlot()];
+		c.lookups.fetch_add(1, std::memory_order_relaxed);
+		c.requestedBytes.fetch_add(s.size() + 1, std::memory_order_relaxed);
+		if( s.empty() ) return internedStr();
+
+		const Key probe { s, std::hash<string_view>()( s ) };
+		Shard& shard = shardOf(probe.hash);
+
+		{
+			std::shared_lock<std::shared_mutex> read(shard.lock);
+			auto it = shard.table.find(probe);
+			if( it != shard.table.end() ) return internedStr(it->s.data(), it->s.size());
+		}
+
+		std::unique_lock<std::shared_mutex> write(shard.lock);
+		// Another thread may have inserted it between the two locks.
+		auto it = shard.table.find(probe);
+		if( it != shard.table.end() ) return internedStr(it->s.data(), it->s.size());
+
+		char* p = static_cast<char*>( shard.arena.allocate(s.size() + 1, 1) );
+		memcpy(p, s.data(), s.size());
+		p[s.size()] = '\0';
+		shard.table.insert(Key { string_view(p, s.size()), probe.hash });
+		shard.storedBytes += s.size() + 1;
+		return internedStr(p, s.size());
+	}
+
+	/**
+	 * @brief Gets the number of distinct non-empty strings in the pool.
+	 */
+	uint64_t size() const {
+		uint64_t n = 0;
+		for( const auto& shard : shards ) {
+			std::shared_lock<std::shared_mutex> read(shard.lock);
+			n += shard.table.size();
+		}
+		return n;
+	}
+
+	/**
+	 * @brief Gets the number of `intern` calls so far.
+	 */
+	uint64_t lookups() const noexcept {
+		uint64_t n = 0;
+		for( const auto& c : counters ) n += c.lookups.load(std::memory_order_relaxed);
+		return n;
+	}
+
+	/**
+	 * @brief Gets the bytes (terminators included) stored once per distinct string.
+	 */
+	uint64_t storedBytes() const {
+		uint64_t n = 0;
+		for( const auto& shard : shards ) {
+			std::shared_lock<std::shared_mutex> read(shard.lock);
+			n += shard.storedBytes;
+		}
+		return n;
+	}
+
+	/**
+	 * @brief Gets the bytes that one copy per `intern` call would have needed.
+	 */
+	uint64_t requestedBytes() const noexcept {
+		uint64_t n = 0;
+		for( const auto& c : counters ) n += c.requestedBytes.load(std::memory_order_relaxed);
+		return n;
+	}
+} __strInternPool;
+
+namespace strUtil {
+	/**
+	 * @brief Interns a string in the global pool.
+	 *
+	 * Unlike `makeUniqueStr`, equal strings are stored once and share one
+	 * handle, which compares in O(1). The pool is safe to use from any
+	 * number of threads.
+	 *
+	 * @param s The characters to intern.
+	 * @return The handle shared by every string equal to `s`.
+	 *
+	 * @note Example usage:
+	 * @code
+	 * auto a = strUtil::internStr("api.example.com");
+	 * auto b = strUtil::internStr(hostFromRequest);
+	 * if( a == b ) { ... } // pointer comparison
+	 * @endcode
+	 */
+	static internedStr internStr(string_view s) {
+		return __strInternPool.intern(s);
+	}
+}
@@ -0,0 +1,482 @@
+/**
+ * @file strlogbin.hh
+ * @author Ian Hylton
+ * @brief Structured logging with a compact binary format and its decoder.
+ * @version 1.0.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) zperk 2024
+ *
+ */
+
+#pragma once
+
+#include "strlogger.hh"
+#include "strloglimit.hh"
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <istream>
+#include <iterator>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using std::string, std::string_view, std::to_string;
+
+/**
+ * @brief Argument type codes stored in a call site's definition.
+ */
+enum class __StrLogArg : uint8_t {
+	INT = 1,    ///< Any signed integer, stored as 8 bytes.
+	UINT = 2,   ///< Any unsigned integer, stored as 8 bytes.
+	DOUBLE = 3, ///< Any floating-point value, stored as 8 bytes.
+	CHAR = 4,   ///< A `char`, stored as 1 byte.
+	BOOL = 5,   ///< A `bool`, stored as 1 byte.
+	STRING = 6, ///< Anything convertible to `string_view`: 4-byte length, then the bytes.
+};
+
+/**
+ * @brief Maps a C++ argument type to its `__StrLogArg` code.
+ */
+template<class T>
+constexpr __StrLogArg __strLogArgOf() noexcept {
+	using U = std::decay_t<T>;
+	if constexpr( std::is_same_v<U, bool> ) return __StrLogArg::BOOL;
+	else if constexpr( std::is_same_v<U, char> ) return __StrLogArg::CHAR;
+	else if constexpr( std::is_integral_v<U> && std::is_signed_v<U> ) return __StrLogArg::INT;
+	else if constexpr( std::is_integral_v<U> ) return __StrLogArg::UINT;
+	else if constexpr( std::is_floating_point_v<U> ) return __StrLogArg::DOUBLE;
+	else {
+		static_assert(std::is_convertible_v<const U&, string_view>, "Unsupported _STRLOGF argument type.");
+		return __StrLogArg::STRING;
+	}
+}
+
+/**
+ * @brief The argument types of a call site, computed at compile time.
+ */
+template<class... A>
+struct __StrLogArgs {
+	static constexpr uint8_t count = sizeof...(A);
+	static constexpr __StrLogArg types[sizeof...(A) + 1] = { __strLogArgOf<A>()..., __StrLogArg::INT };
+};
+
+/// @brief Only used in `decltype` to deduce the argument types of a call site.
+template<class... A>
+__StrLogArgs<A...> __strLogArgsOf(const A&...);
+
+/**
+ * @class __StrLogSite
+ * @brief The static part of one `_STRLOGF` call site.
+ *
+ * Every call site owns one of these as a function-local static, so the
+ * level, location, format and argument types are recorded once. A binary log
+ * only stores them once per file (the first time the site is hit after the
+ * file was opened); each record then carries only the site ID. A description
+ * that was dropped (full queue, DROP policy) is sent again with the next record.
+ */
+struct __StrLogSite {
+	__StrToolsLogLvl level;
+	const char* file;
+	uint32_t line;
+	const char* format;
+	uint8_t argCount;
+	const __StrLogArg* argTypes;
+	uint32_t id;
+	/// @brief The binary log generation this site's description was last queued for.
+	std::atomic<uint32_t> describedIn { 0 };
+
+	template<class Args>
+	__StrLogSite(__StrToolsLogLvl lvl, const char* f, uint32_t l, const char* fmt, Args) noexcept
+		: level(lvl), file(f), line(l), format(fmt), argCount(Args::count), argTypes(Args::types),
+		id(nextId().fetch_add(1, std::memory_order_relaxed)) {}
+
+	static std::atomic<uint32_t>& nextId() noexcept {
+		static std::atomic<uint32_t> id { 1 };
+		return id;
+	}
+};
+
+/**
+ * @class __StrLogBinary
+ * @brief Encodes records for the binary log and formats them as text.
+ *
+ * A binary log starts with the 8-byte magic `STRLOGB1` and then holds two
+ * kinds of entries, all integers in host byte order:
+ *
+ * - `'S'` site: u32 id, u8 level, u32 line, u8 argc, argc type bytes,
+ *   u16 + file name, u16 + format.
+ * - `'L'` record: u32 site id, u64 nanoseconds since the Unix epoch,
+ *   u32 size of the arguments, then the arguments (8 bytes per number, 1 per
+ *   char/bool, u32 + bytes per string).
+ *
+ * Formats use `{}` as the placeholder for the next argument.
+ */
+class __StrLogBinary {
+public:
+	static constexpr char magic[9] = "STRLOGB1";
+
+	/**
+	 * @brief Appends raw bytes of a trivially copyable value.
+	 */
+	template<class T>
+	static void put(string& out, const T& v) {
+		out.append(reinterpret_cast<const char*>( &v ), sizeof(T));
+	}
+
+	/**
+	 * @brief Appends a length-prefixed string.
+	 */
+	template<class Len>
+	static void putString(string& out, string_view s) {
+		const Len n = static_cast<Len>( s.size() < Len(~Len(0)) ? s.size() : Len(~Len(0)) );
+		put(out, n);
+		out.append(s.data(), n);
+	}
+
+	/**
+	 * @brief Appends the `'S'` entry describing a call site.
+	 */
+	static void describe(string& out, const __StrLogSite& site) {
+		out += 'S';
+		put(out, site.id);
+		put(out, static_cast<uint8_t>( site.level ));
+		put(out, site.line);
+		put(out, site.argCount);
+		for( uint8_t k = 0; k < site.argCount; ++k ) put(out, static_cast<uint8_t>( site.argTypes[k] ));
+		putString<uint16_t>(out, site.file);
+		putString<uint16_t>(out, site.format);
+	}
+
+	/**
+	 * @brief Appends one argument in its binary form.
+	 */
+	template<class T>
+	static void putArg(string& out, const T& v) {
+		constexpr __StrLogArg type = __strLogArgOf<T>();
+		if constexpr( type == __StrLogArg::INT ) put(out, static_cast<int64_t>( v ));
+		else if constexpr( type == __StrLogArg::UINT ) put(out, static_cast<uint64_t>( v ));
+		else if constexpr( type == __StrLogArg::DOUBLE ) put(out, static_cast<double>( v ));
+		else if constexpr( type == __StrLogArg::CHAR || type == __StrLogArg::BOOL ) put(out, static_cast<uint8_t>( v ));
+		else putString<uint32_t>(out, string_view(v));
+	}
+
+	/**
+	 * @brief Appends the text of one argument, as the decoder prints it.
+	 */
+	template<class T>
+	static void appendArg(string& out, const T& v) {
+		constexpr __StrLogArg type = __strLogArgOf<T>();
+		if constexpr( type == __StrLogArg::INT || type == __StrLogArg::UINT ) {
+			char digits[24];
+			const auto r = type == __StrLogArg::INT
+				? std::to_chars(digits, digits + sizeof(digits), static_cast<int64_t>( v ))
+				: std::to_chars(digits, digits + sizeof(digits), static_cast<uint64_t>( v ));
+			out.append(digits, static_cast<size_t>( r.ptr - digits ));
+		}
+		else if constexpr( type == __StrLogArg::DOUBLE ) out += to_string(static_cast<double>( v ));
+		else if constexpr( type == __StrLogArg::CHAR ) out += static_cast<char>( v );
+		else if constexpr( type == __StrLogArg::BOOL ) out += v ? "true" : "false";
+		else out += string_view(v);
+	}
+
+	/**
+	 * @brief Replaces each `{}` in `format` with the next argument text.
+	 *
+	 * Placeholders without an argument are kept as they are.
+	 */
+	static string substitute(string_view format, const string* args, const size_t count) {
+		string out;
+		out.reserve(format.size() + 16 * count);
+		size_t next = 0;
+		for( size_t i = 0; i < format.size(); ++i ) {
+			if( format[i] == '{' && i + 1 < format.size() && format[i + 1] == '}' && next < count ) {
+				out += args[next++];
+				++i;
+			} else {
+				out += format[i];
+			}
+		}
+		return out;
+	}
+
+	/**
+	 * @brief Logs one record through `__strToolsLogger`, in binary or as text.
+	 */
+	template<class... A>
+	static void log(__StrLogSite& site, const A&... args) {
+		string& record = __StrLogger::threadBuffer();
+		if( __strToolsLogger.isBinary() ) {
+			// The site is only marked as described once its 'S' entry was
+			// accepted; threads racing here may describe it twice, which the
+			// decoder tolerates.
+			const uint32_t generation = __strToolsLogger.binaryGeneration();
+			const bool describing = site.describedIn.load(std::memory_order_relaxed) != generation;
+			if( describing ) describe(record, site);
+			record += 'L';
+			put(record, site.id);
+			const uint64_t ns = static_cast<uint64_t>( __StrLogClock::now() );
+			put(record, ns);
+			const size_t sizeAt = record.size();
+			put(record, uint32_t(0));
+			( putArg(record, args), ... );
+			const uint32_t argBytes = static_cast<uint32_t>( record.size() - sizeAt - sizeof(uint32_t) );
+			memcpy(&record[sizeAt], &argBytes, sizeof(argBytes));
+			if( __strToolsLogger.commit(__StrToolsLogLvl::INFO, record, true) && describing ) {
+				site.describedIn.store(generation, std::memory_order_relaxed);
+			}
+			return;
+		}
+		// Same result as `substitute`, but formatted straight into the thread's buffer.
+		const string_view format = site.format;
+		size_t at = 0;
+		auto emit = [&](const auto& v) {
+			const size_t hole = format.find("{}", at);
+			if( hole == string_view::npos ) return;
+			record.append(format.data() + at, hole - at);
+			appendArg(record, v);
+			at = hole + 2;
+		};
+		( emit(args), ... );
+		record.append(format.data() + at, format.size() - at);
+		__strToolsLogger.commit(site.level, record);
+	}
+};
+
+/**
+ * @class __StrLogDecoder
+ * @brief Turns a binary log back into "timestamp [LEVEL] message" lines.
+ *
+ * The output matches what the text logger would have written. Site entries
+ * may appear anywhere in the file (even after records that use them), so the
+ * whole log is read first.
+ */
+class __StrLogDecoder {
+private:
+	struct Site {
+		uint8_t level = 0;
+		std::vector<__StrLogArg> types;
+		string format;
+	};
+
+	std::unordered_map<uint32_t, Site> sites;
+	/// @brief Site IDs already reported as unknown.
+	std::unordered_set<uint32_t> unknown;
+	string data;
+	size_t pos = 0;
+	uint64_t skipped = 0;
+
+	template<class T>
+	bool get(T& v) noexcept {
+		if( data.size() - pos < sizeof(T) ) return false;
+		memcpy(&v, data.data() + pos, sizeof(T));
+		pos += sizeof(T);
+		return true;
+	}
+
+	template<class Len>
+	bool getString(string& s) {
+		Len n;
+		if( !get(n) || data.size() - pos < n ) return false;
+		s.assign(data.data() + pos, n);
+		pos += n;
+		return true;
+	}
+
+	bool readSite(const bool keep) {
+		uint32_t id, line;
+		Site site;
+		uint8_t argc;
+		string file;
+		if( !get(id) || !get(site.level) || !get(line) || !get(argc) ) return false;
+		for( uint8_t k = 0; k < argc; ++k ) {
+			uint8_t t;
+			if( !get(t) ) return false;
+			site.types.push_back(static_cast<__StrLogArg>( t ));
+		}
+		if( !getString<uint16_t>(file) || !getString<uint16_t>(site.format) ) return false;
+		if( keep ) sites[id] = std::move(site);
+		return true;
+	}
+
+	bool readArgs(const Site& site, std::vector<string>& text) {
+		text.clear();
+		for( const __StrLogArg t : site.types ) {
+			switch( t ) {
+			case __StrLogArg::INT: { int64_t v; if( !get(v) ) return false; text.push_back(to_string(v)); break; }
+			case __StrLogArg::UINT: { uint64_t v; if( !get(v) ) return false; text.push_back(to_string(v)); break; }
+			case __StrLogArg::DOUBLE: { double v; if( !get(v) ) return false; text.push_back(to_string(v)); break; }
+			case __StrLogArg::CHAR: { uint8_t v; if( !get(v) ) return false; text.push_back(string(1, static_cast<char>( v ))); break; }
+			case __StrLogArg::BOOL: { uint8_t v; if( !get(v) ) return false; text.push_back(v ? "true" : "false"); break; }
+			default: { string v; if( !getString<uint32_t>(v) ) return false; text.push_back(std::move(v)); break; }
+			} // switch( t )
+		}
+		return true;
+	}
+
+	static const char* levelName(const uint8_t level) noexcept {
+		switch( level ) {
+		case 0: return "INFO";
+		case 1: return "WARNING";
+		case 2: return "ERROR";
+		default: return "UNKNOWN";
+		} // switch( level )
+	}
+
+public:
+	/**
+	 * @brief Gets the number of records the last `decode` skipped because
+	 * their site was never described.
+	 */
+	uint64_t skippedRecords() const noexcept {
+		return skipped;
+	}
+
+	/**
+	 * @brief Decodes a whole binary log.
+	 *
+	 * @param in The binary log.
+	 * @param out Receives one text line per record.
+	 * @param err Receives a message if the log is malformed or truncated, and
+	 * one per unknown site whose records are skipped.
+	 * @param precision Sub-second digits in the timestamps (0-9).
+	 * @return The number of records decoded.
+	 */
+	uint64_t decode(std::istream& in, std::ostream& out, std::ostream& err, const unsigned precision = 0) {
+		data.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+		sites.clear();
+		unknown.clear();
+		skipped = 0;
+		if( data.compare(0, 8, __StrLogBinary::magic) != 0 ) {
+			err << "Not a strtools binary log (bad magic)." << "\n";
+			return 0;
+		}
+
+		// Pass 1: collect every site definition. A site may be described after
+		// records that use it (records from several threads interleave), and
+		// records carry their size, so they can be skipped without it.
+		pos = 8;
+		while( pos < data.size() ) {
+			const char kind = data[pos++];
+			if( kind == 'S' ) {
+				if( !readSite(true) ) break;
+				continue;
+			}
+			uint32_t id, argBytes;
+			uint64_t ns;
+			if( kind != 'L' || !get(id) || !get(ns) || !get(argBytes) || data.size() - pos < argBytes ) break;
+			pos += argBytes;
+		}
+
+		// Pass 2: print.
+		uint64_t records = 0;
+		std::vector<string> text;
+		char stamp[__StrLogClock::maxLength];
+		pos = 8;
+		while( pos < data.size() ) {
+			const char kind = data[pos++];
+			if( kind == 'S' ) {
+				if( !readSite(false) ) break;
+				continue;
+			}
+			uint32_t id, argBytes;
+			uint64_t ns;
+			if( kind != 'L' || !get(id) || !get(ns) || !get(argBytes) ) {
+				err << "Malformed entry at byte " << pos << "." << "\n";
+				return records;
+			}
+			auto it = sites.find(id);
+			if( it == sites.end() ) {
+				// Its description was lost (e.g. dropped with a full queue);
+				// the record's size still lets the rest of the log be read.
+				if( data.size() - pos < argBytes ) {
+					err << "Truncated record at byte " << pos << "." << "\n";
+					return records;
+				}
+				if( unknown.insert(id).second ) {
+					err << "Record at byte " << pos << " uses unknown site " << id << "; skipping its records." << "\n";
+				}
+				pos += argBytes;
+				++skipped;
+				continue;
+			}
+			if( !readArgs(it->second, text) ) {
+				err << "Truncated record at byte " << pos << "." << "\n";
+				return records;
+			}
+			const size_t stampLength = __StrLogClock::format(static_cast<int64_t>( ns ), precision, stamp);
+			out.write(stamp, static_cast<std::streamsize>( stampLength ));
+			out << " [" << levelName(it->second.level) << "] "
+				<< __StrLogBinary::substitute(it->second.format, text.data(), text.size()) << "\n";
+			++records;
+		}
+		return records;
+	}
+};
+
+/**
+ * @brief Logs a formatted message at `lvl` from a registered call site.
+ *
+ * `fmt` must be a string literal; each `{}` is replaced by the next argument
+ * (integers, floating-point values, `char`, `bool` or anything convertible to
+ * `string_view`). At least one argument is required.
+ *
+ * The call site's level, location, format and argument types are recorded
+ * once. In binary mode (`__strToolsLogger.setBinaryLogFile`) a record is just
+ * the site ID, a timestamp and the raw argument bytes; nothing is formatted.
+ * Otherwise the message is formatted and logged like `_STRLOG`. As with
+ * `_STRLOG`, nothing is evaluated while the logger is disabled.
+ *
+ * @note Example usage:
+ * @code
+ * _STRLOGF("subStr(string_view, uint64_t, uint64_t): {}, {}, {}", s.size(), i, j);
+ * @endcode
+ */
+#define _STRLOGF_AT(lvl, fmt, ...) \
+	do { \
+		if constexpr( static_cast<int>( lvl ) >= STRTOOLS_LOG_MIN_LEVEL ) { \
+			if( __strToolsLogger.loggerStatus() ) { \
+				static __StrLogSite __strLogSite( \
+					( lvl ), __FILE__, __LINE__, fmt, decltype( __strLogArgsOf(__VA_ARGS__) ) {} \
+				); \
+				__StrLogBinary::log(__strLogSite, __VA_ARGS__); \
+			} \
+		} \
+	} while( 0 )
+
+/**
+ * @brief Logs a formatted INFO message (see `_STRLOGF_AT`).
+ */
+#define _STRLOGF(fmt, ...) _STRLOGF_AT(__StrToolsLogLvl::INFO, fmt, __VA_ARGS__)
+
+/**
+ * @brief Logs like `_STRLOGF_AT`, but rate limited per call site.
+ *
+ * See `_STRLOG_LIMIT_AT` for the limits. The count of suppressed messages is
+ * logged, with the site's format, just before the next message that gets
+ * through, and once per `STRTOOLS_LOG_REPORT_MS` while messages keep being
+ * suppressed.
+ */
+#define _STRLOGF_LIMIT_AT(lvl, fmt, ...) \
+	do { \
+		if constexpr( static_cast<int>( lvl ) >= STRTOOLS_LOG_MIN_LEVEL ) { \
+			if( __strToolsLogger.loggerStatus() ) { \
+				static __StrLogLimiter __strLogLimit(STRTOOLS_LOG_RATE, STRTOOLS_LOG_BURST, STRTOOLS_LOG_SAMPLE); \
+				uint64_t __strLogSkipped = 0; \
+				const bool __strLogPass = __strLogLimit.allow(__strLogSkipped); \
+				if( __strLogSkipped ) \
+					_STRLOGF_AT(lvl, "{} similar messages suppressed: {}", __strLogSkipped, string_view(fmt)); \
+				if( __strLogPass ) _STRLOGF_AT(lvl, fmt, __VA_ARGS__); \
+			} \
+		} \
+	} while( 0 )
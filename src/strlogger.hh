@@ -11,42 +11,550 @@
 
 #pragma once
 
+#include "strlogsink.hh"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <ctime>
 #include <fstream>
 #include <ios>
 #include <iosfwd>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
 
 using std::cout, std::cerr, std::endl;
-using std::string;
+using std::string, std::string_view;
 using std::ofstream;
 
-enum class __StrToolsLogLvl {
-	INFO = 0,
-	WARNING = 1,
-	ERROR = 2,
+/**
+ * @brief Lowest log level compiled into the library.
+ *
+ * 0 = INFO, 1 = WARNING, 2 = ERROR; 3 removes every `_STRLOG` call. Define it
+ * before including the library, e.g. `-DSTRTOOLS_LOG_MIN_LEVEL=2`.
+ */
+#ifndef STRTOOLS_LOG_MIN_LEVEL
+#define STRTOOLS_LOG_MIN_LEVEL 0
+#endif
+
+/**
+ * @brief What an asynchronous `log()` call does when the ring buffer is full.
+ */
+enum class __StrLogOverflow {
+	DROP = 0,  ///< Discard the record and count it (callers never wait).
+	BLOCK = 1, ///< Wait until the writer thread makes room.
+};
+
+/**
+ * @class __StrLogRing
+ * @brief Bounded lock-free multi-producer, single-consumer queue of log records.
+ *
+ * Every slot carries a sequence number that says whether it is free for the
+ * producer at a given position or ready for the consumer. A producer claims a
+ * position with one CAS on `tail`, moves its record in, and publishes it by
+ * advancing the slot's sequence; no producer ever takes a lock. The single
+ * consumer (the writer thread) swaps records out, so message buffers are
+ * recycled instead of freed.
+ */
+class __StrLogRing {
+public:
+	struct Record {
+		__StrToolsLogLvl level = __StrToolsLogLvl::INFO;
+		/// @brief Nanoseconds since the epoch.
+		int64_t time = 0;
+		/// @brief `message` holds an encoded binary record instead of text.
+		bool binary = false;
+		string message;
+	};
+
+private:
+	struct alignas(64) Slot {
+		std::atomic<size_t> seq;
+		Record record;
+	};
+
+	std::unique_ptr<Slot[]> slots;
+	size_t mask;
+	alignas(64) std::atomic<size_t> tail { 0 };
+	alignas(64) size_t head = 0;
+
+public:
+	/**
+	 * @brief Creates a ring with room for at least `capacity` records.
+	 *
+	 * @param capacity The minimum capacity; rounded up to a power of two.
+	 */
+	explicit __StrLogRing(const size_t capacity) {
+		size_t n = 2;
+		while( n < capacity ) n <<= 1;
+		slots = std::make_unique<Slot[]>(n);
+		for( size_t i = 0; i < n; ++i ) slots[i].seq.store(i, std::memory_order_relaxed);
+		mask = n - 1;
+	}
+
+	/**
+	 * @brief Gets the number of slots.
+	 */
+	size_t capacity() const noexcept {
+		return mask + 1;
+	}
+
+	/**
+	 * @brief Moves a record into the ring (any thread).
+	 *
+	 * @param r The record; left empty on success.
+	 * @return `false` if the ring is full.
+	 */
+	bool tryPush(Record& r) noexcept {
+		size_t pos = tail.load(std::memory_order_relaxed);
+		for( ;;) {
+			Slot& slot = slots[pos & mask];
+			const size_t seq = slot.seq.load(std::memory_order_acquire);
+			const intptr_t diff = static_cast<intptr_t>( seq ) - static_cast<intptr_t>( pos );
+			if( diff == 0 ) {
+				if( tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed) ) {
+					slot.record.level = r.level;
+					slot.record.time = r.time;
+					slot.record.binary = r.binary;
+					slot.record.message.swap(r.message);
+					slot.seq.store(pos + 1, std::memory_order_release);
+					return true;
+				}
+			} else if( diff < 0 ) {
+				return false; // The consumer has not freed this slot yet.
+			} else {
+				pos = tail.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/**
+	 * @brief Takes the oldest record out of the ring (writer thread only).
+	 *
+	 * @param out Receives the record; its old message buffer goes back to the slot.
+	 * @return `false` if the ring is empty.
+	 */
+	bool tryPop(Record& out) noexcept {
+		Slot& slot = slots[head & mask];
+		if( slot.seq.load(std::memory_order_acquire) != head + 1 ) return false;
+		out.level = slot.record.level;
+		out.time = slot.record.time;
+		out.binary = slot.record.binary;
+		out.message.swap(slot.record.message);
+		slot.seq.store(head + mask + 1, std::memory_order_release);
+		++head;
+		return true;
+	}
 };
 
+/**
+ * @class __StrLogClock
+ * @brief Cheap clock reads and cached "YYYY-MM-DD HH:MM:SS" formatting.
+ *
+ * Converting a time to local calendar fields is the expensive part of a
+ * timestamp (`localtime` also takes a lock in glibc). Each thread keeps the
+ * formatted prefix of the last second it saw and only rebuilds it when the
+ * second changes; the sub-second digits are written by hand.
+ */
+class __StrLogClock {
+private:
+	struct Cache {
+		int64_t second = INT64_MIN;
+		char text[20] = {};
+	};
+
+	/**
+	 * @brief Thread-safe `localtime`.
+	 */
+	static void localTime(const time_t t, std::tm& out) noexcept {
+#ifdef _WIN32
+		localtime_s(&out, &t);
+#else
+		localtime_r(&t, &out);
+#endif
+	}
+
+public:
+	/// @brief Longest output of `format()`: 19 characters, a dot and 9 digits.
+	static constexpr size_t maxLength = 29;
+
+	/**
+	 * @brief Reads the wall clock in nanoseconds since the epoch.
+	 *
+	 * @param precise `false` allows a coarse clock (a few milliseconds of
+	 * resolution, but cheaper to read) when only whole seconds are needed.
+	 */
+	static int64_t now(const bool precise = true) noexcept {
+#if defined( __linux__ ) && defined( CLOCK_REALTIME_COARSE )
+		if( !precise ) {
+			timespec ts;
+			clock_gettime(CLOCK_REALTIME_COARSE, &ts);
+			return static_cast<int64_t>( ts.tv_sec ) * 1000000000 + ts.tv_nsec;
+		}
+#else
+		(void) precise;
+#endif
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::system_clock::now().time_since_epoch()).count();
+	}
+
+	/**
+	 * @brief Formats a time as "YYYY-MM-DD HH:MM:SS" plus `digits` fractional digits.
+	 *
+	 * @param ns Nanoseconds since the epoch.
+	 * @param digits Sub-second digits (0-9); 0 leaves out the dot.
+	 * @param out Receives at least `maxLength` characters (not terminated).
+	 * @return The number of characters written.
+	 */
+	static size_t format(const int64_t ns, unsigned digits, char* out) noexcept {
+		static thread_local Cache cache;
+		int64_t second = ns / 1000000000;
+		int64_t frac = ns % 1000000000;
+		if( frac < 0 ) {
+			frac += 1000000000;
+			--second;
+		}
+		if( second != cache.second ) {
+			std::tm tm {};
+			localTime(static_cast<time_t>( second ), tm);
+			std::strftime(cache.text, sizeof(cache.text), "%Y-%m-%d %H:%M:%S", &tm);
+			cache.second = second;
+		}
+		memcpy(out, cache.text, 19);
+		if( digits == 0 ) return 19;
+		if( digits > 9 ) digits = 9;
+		out[19] = '.';
+		for( unsigned i = 9; i > digits; --i ) frac /= 10;
+		for( unsigned i = digits; i > 0; --i ) {
+			out[19 + i] = static_cast<char>( '0' + frac % 10 );
+			frac /= 10;
+		}
+		return 20 + digits;
+	}
+};
+
+/**
+ * @class __StrLogger
+ * @brief The library logger; safe to use from any number of threads.
+ *
+ * Each thread builds its record in its own buffer (`threadBuffer()`) and
+ * hands it over whole with `commit()`. Formatted lines go to every attached
+ * sink (see strlogsink.hh) whose level filter accepts them. Synchronous
+ * writes of a record happen under one lock, so lines never interleave; in
+ * asynchronous mode producers never take that lock at all.
+ */
 class __StrLogger {
 private:
-	ofstream logFile;
-	bool isFileOpen;
-	bool isLoggerEnabled;
+	std::atomic<bool> isFileOpen;
+	std::atomic<bool> isLoggerEnabled;
+	/// @brief Serializes writes to the sinks and the binary file, and changes to them.
+	std::mutex outputLock;
+
+	// Text records go to every sink in `sinks`; `setLogFile` and
+	// `setConsoleEcho` manage one file sink and one terminal sink in it.
+	std::vector<std::shared_ptr<__StrLogSink>> sinks;
+	std::atomic<size_t> sinkCount { 0 };
+	std::shared_ptr<__StrLogFileSink> fileSink;
+	std::shared_ptr<__StrLogStdoutSink> consoleSink;
+
+	// Binary mode: structured records go to `binaryFile` (see strlogbin.hh),
+	// a file sink that is not in `sinks`, so it is buffered the same way.
+	std::shared_ptr<__StrLogFileSink> binaryFile;
+	std::atomic<uint32_t> binaryGen { 0 };
+	std::atomic<bool> isBinaryOpen { false };
+
+	// Asynchronous mode: producers push into `ring`, `writer` drains it.
+	std::unique_ptr<__StrLogRing> ring;
+	std::thread writer;
+	__StrLogOverflow overflow = __StrLogOverflow::DROP;
+	std::atomic<bool> stopWriter { false };
+	std::atomic<bool> writerSleeping { false };
+	std::atomic<uint64_t> pushed { 0 };
+	std::atomic<uint64_t> written { 0 };
+	std::atomic<uint64_t> droppedRecords { 0 };
+	std::mutex wakeLock;
+	std::condition_variable wake;
+	std::condition_variable drained;
+
+	// Synchronous mode: `ticker` ticks the sinks so they flush by age even
+	// while nothing is logged. It runs only while a sink needs it.
+	std::thread ticker;
+	std::mutex tickerLock;
+	std::condition_variable tickerWake;
+	bool stopTicker = false;
+
+	/// @brief How often buffered sinks get a `tick`.
+	static constexpr std::chrono::milliseconds tickPeriod { 10 };
+
+	/// @brief Sub-second digits in text timestamps (0-9).
+	std::atomic<unsigned> timestampDigits { 0 };
+
+	/// @brief Records the writer formats before it writes them out in one go.
+	static constexpr size_t maxBatch = 256;
 
 	/**
-	 * @brief Gets the current timestamp.
+	 * @brief Appends "timestamp [LEVEL] message\n" to `out`.
+	 */
+	void formatLine(string& out, __StrToolsLogLvl level, const int64_t time, const string& message) {
+		char stamp[__StrLogClock::maxLength];
+		out.append(stamp, __StrLogClock::format(time, timestampDigits.load(std::memory_order_relaxed), stamp));
+		out += " [";
+		out += logLevelToString(level);
+		out += "] ";
+		out += message;
+		out += '\n';
+	}
+
+	/**
+	 * @brief Hands one line to every sink that accepts its level (output lock held).
+	 */
+	void dispatch(__StrToolsLogLvl level, string_view line) {
+		for( const auto& sink : sinks ) {
+			if( sink->accepts(level) ) sink->write(level, line);
+		}
+	}
+
+	/**
+	 * @brief Flushes every sink and the binary file (output lock held).
+	 */
+	void flushOutputs() {
+		for( const auto& sink : sinks ) sink->flush();
+		if( binaryFile ) binaryFile->flush();
+	}
+
+	/**
+	 * @brief Writes out every sink and the binary file without stalling producers.
 	 *
-	 * This function retrieves the current time and formats it
-	 * as a string in the format "YYYY-MM-DD HH:MM:SS".
+	 * The buffers are handed off under the output lock, which only moves
+	 * them; the device writes happen after it is released.
+	 */
+	void flushUnlocked() {
+		std::vector<std::shared_ptr<__StrLogSink>> targets;
+		{
+			std::lock_guard<std::mutex> output(outputLock);
+			targets.reserve(sinks.size() + 1);
+			for( const auto& sink : sinks ) {
+				sink->handOff();
+				targets.push_back(sink);
+			}
+			if( binaryFile ) {
+				binaryFile->handOff();
+				targets.push_back(binaryFile);
+			}
+		}
+		for( const auto& sink : targets ) sink->drain();
+	}
+
+	/**
+	 * @brief Ticks every sink and the binary file, then drains those that are due.
 	 *
-	 * @return A string containing the formatted timestamp.
+	 * Like `flushUnlocked`, the device writes happen outside the output lock.
+	 */
+	void tickSinks() {
+		std::vector<std::shared_ptr<__StrLogSink>> due;
+		{
+			std::lock_guard<std::mutex> output(outputLock);
+			for( const auto& sink : sinks ) {
+				if( sink->tick() ) due.push_back(sink);
+			}
+			if( binaryFile && binaryFile->tick() ) due.push_back(binaryFile);
+		}
+		for( const auto& sink : due ) sink->drain();
+	}
+
+	/**
+	 * @brief Ticker thread: ticks the sinks every `tickPeriod` until stopped.
+	 */
+	void tickerLoop() {
+		std::unique_lock<std::mutex> lock(tickerLock);
+		while( !tickerWake.wait_for(lock, tickPeriod, [this] { return stopTicker; }) ) {
+			lock.unlock();
+			tickSinks();
+			lock.lock();
+		}
+	}
+
+	/**
+	 * @brief Starts the ticker if the logger is synchronous and a sink flushes by age.
+	 */
+	void startTicker() {
+		if( ring ) return;
+		bool needed = false;
+		{
+			std::lock_guard<std::mutex> output(outputLock);
+			needed = binaryFile && binaryFile->flushesByAge();
+			for( const auto& sink : sinks ) needed = needed || sink->flushesByAge();
+		}
+		std::lock_guard<std::mutex> lock(tickerLock);
+		if( !needed || ticker.joinable() ) return;
+		stopTicker = false;
+		ticker = std::thread(&__StrLogger::tickerLoop, this);
+	}
+
+	/**
+	 * @brief Drains the ring and joins the writer thread, if it runs.
+	 */
+	void stopWriterThread() {
+		if( !writer.joinable() ) return;
+		stopWriter.store(true, std::memory_order_release);
+		wake.notify_one();
+		writer.join();
+		ring.reset();
+	}
+
+	/**
+	 * @brief Stops and joins the ticker, if it runs (output lock not held).
 	 */
-	string getTimestamp() {
-		time_t now = std::time(nullptr);
-		char buf[20];
-		std::strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", std::localtime(&now));
-		return string(buf);
+	void stopTickerThread() {
+		std::thread running;
+		{
+			std::lock_guard<std::mutex> lock(tickerLock);
+			stopTicker = true;
+			running.swap(ticker);
+		}
+		tickerWake.notify_all();
+		if( running.joinable() ) running.join();
+	}
+
+	/**
+	 * @brief Writer thread: drains the ring in batches until stopped.
+	 *
+	 * A batch is formatted outside the output lock, then handed to the sinks
+	 * in one go. Buffered sinks also get a `tick` at least every `tickPeriod`,
+	 * so they can flush by age while the ring is idle.
+	 */
+	void writerLoop() {
+		__StrLogRing::Record r;
+		string batch, binaryBatch;
+		// Level and end offset of each line in `batch`.
+		std::vector<std::pair<__StrToolsLogLvl, size_t>> lines;
+		for( ;;) {
+			// Read the flag first: once it is set, an empty ring means we are done.
+			const bool stopping = stopWriter.load(std::memory_order_acquire);
+			size_t n = 0;
+			while( n < maxBatch && ring->tryPop(r) ) {
+				++n;
+				if( r.binary ) {
+					binaryBatch += r.message;
+					continue;
+				}
+				formatLine(batch, r.level, r.time, r.message);
+				lines.emplace_back(r.level, batch.size());
+			}
+
+			if( n ) {
+				std::unique_lock<std::mutex> output(outputLock);
+				size_t begin = 0;
+				for( const auto& [level, end] : lines ) {
+					dispatch(level, string_view(batch).substr(begin, end - begin));
+					begin = end;
+				}
+				batch.clear();
+				lines.clear();
+				if( !binaryBatch.empty() ) {
+					if( binaryFile ) binaryFile->write(__StrToolsLogLvl::INFO, binaryBatch);
+					binaryBatch.clear();
+				}
+				output.unlock();
+				tickSinks();
+				{
+					std::lock_guard<std::mutex> lock(wakeLock);
+					written.fetch_add(n, std::memory_order_release);
+				}
+				drained.notify_all();
+				continue;
+			}
+
+			if( stopping ) break;
+			tickSinks();
+			std::unique_lock<std::mutex> lock(wakeLock);
+			writerSleeping.store(true, std::memory_order_seq_cst);
+			// Producers only notify a sleeping writer; the timeout covers the
+			// race where a record lands just before we start waiting.
+			wake.wait_for(lock, tickPeriod);
+			writerSleeping.store(false, std::memory_order_relaxed);
+		}
+		std::lock_guard<std::mutex> output(outputLock);
+		flushOutputs();
+	}
+
+	/**
+	 * @brief Wakes the writer thread if it is waiting for records.
+	 */
+	void wakeWriter() {
+		// Only the first producer after the writer went to sleep pays for the notify.
+		if( writerSleeping.load(std::memory_order_seq_cst)
+			&& writerSleeping.exchange(false, std::memory_order_seq_cst) ) {
+			wake.notify_one();
+		}
+	}
+
+	/**
+	 * @brief Queues a record for the writer thread.
+	 *
+	 * The message is swapped into the ring, and `message` gets back the
+	 * buffer of a record the writer already printed (emptied), so a thread
+	 * that reuses its buffer stops allocating once the ring has warmed up.
+	 *
+	 * @return `false` if the ring was full and the DROP policy discarded the record.
+	 */
+	bool enqueue(__StrToolsLogLvl level, string& message, const bool binary = false) {
+		__StrLogRing::Record r;
+		r.level = level;
+		r.binary = binary;
+		r.time = __StrLogClock::now(timestampDigits.load(std::memory_order_relaxed) != 0);
+		r.message.swap(message);
+		bool queued = true;
+		while( !ring->tryPush(r) ) {
+			if( overflow == __StrLogOverflow::DROP ) {
+				droppedRecords.fetch_add(1, std::memory_order_relaxed);
+				queued = false;
+				break;
+			}
+			wakeWriter();
+			std::this_thread::yield();
+		}
+		message.swap(r.message);
+		message.clear();
+		if( !queued ) return false;
+		pushed.fetch_add(1, std::memory_order_release);
+		wakeWriter();
+		return true;
+	}
+
+	/**
+	 * @brief Formats one text record and hands it to the sinks.
+	 */
+	void writeRecord(__StrToolsLogLvl level, const string& message) {
+		if( sinkCount.load(std::memory_order_relaxed) == 0 ) return;
+		static thread_local string line;
+		line.clear();
+		formatLine(line, level, __StrLogClock::now(timestampDigits.load(std::memory_order_relaxed) != 0), message);
+		std::lock_guard<std::mutex> output(outputLock);
+		dispatch(level, line);
+	}
+
+	/**
+	 * @brief Replaces `current` with `next` in the sink list (output lock held).
+	 */
+	template<class T>
+	void swapSink(std::shared_ptr<T>& current, std::shared_ptr<T> next) {
+		if( current ) {
+			current->flush();
+			sinks.erase(std::remove(sinks.begin(), sinks.end(), current), sinks.end());
+		}
+		current = std::move(next);
+		if( current ) sinks.push_back(current);
+		sinkCount.store(sinks.size(), std::memory_order_relaxed);
 	}
 
 	/**
@@ -83,10 +591,11 @@ public:
 	 * flushed and closed.
 	 */
 	~__StrLogger() {
-		if( isFileOpen ) {
-			logFile.flush();
-			logFile.close();
-		}
+		stopWriterThread();
+		stopTickerThread();
+		std::lock_guard<std::mutex> output(outputLock);
+		flushOutputs();
+		binaryFile.reset();
 	}
 
 	/**
@@ -95,7 +604,8 @@ public:
 	 * This function enables or disables the logger.
 	 */
 	void toggleLogger() noexcept {
-		isLoggerEnabled = !isLoggerEnabled;
+		bool enabled = isLoggerEnabled.load(std::memory_order_relaxed);
+		while( !isLoggerEnabled.compare_exchange_weak(enabled, !enabled, std::memory_order_acq_rel) ) {}
 	}
 
 	/**
@@ -106,49 +616,308 @@ public:
 	 * @return True if the logger is enabled, false otherwise.
 	 */
 	bool loggerStatus() const noexcept {
-		return isLoggerEnabled;
+		return isLoggerEnabled.load(std::memory_order_relaxed);
 	}
 
 	/**
 	 * @brief Sets the log file.
 	 *
 	 * This function sets the log file to the provided filename. If a log file
-	 * is already open, it closes it before opening the new file.
+	 * is already open, it closes it before opening the new file. Writes are
+	 * buffered and go out every 64 KiB or once a second, also while nothing
+	 * is logged (see `__StrLogFileSink`; attach one with `addSink` for
+	 * rotation or a level filter).
 	 *
 	 * @param filename The name of the file to log to.
 	 */
 	void setLogFile(const string& filename) noexcept {
 		if( !isLoggerEnabled ) return;
-		// If the same filename is provided, close the file.
-		if( isFileOpen )
-			logFile.close();
-		// Else, open the file and check if it's open.
-		logFile.open(filename, std::ios::out | std::ios::trunc);
-		if( logFile.is_open() ) {
-			isFileOpen = true;
-		} else { // If it failed, show an error in the terminal.
-			cerr << "Failed to open log file: " << filename << endl;
-			isFileOpen = false;
+		// Write out what is queued for the old file first.
+		if( ring ) flush();
+		{
+			std::lock_guard<std::mutex> output(outputLock);
+			// Open the new file, then swap it for the old one.
+			auto file = std::make_shared<__StrLogFileSink>(filename);
+			if( file->isOpen() ) {
+				swapSink(fileSink, file);
+				isFileOpen = true;
+			} else { // If it failed, show an error in the terminal.
+				cerr << "Failed to open log file: " << filename << endl;
+				swapSink(fileSink, std::shared_ptr<__StrLogFileSink>());
+				isFileOpen = false;
+			}
+		}
+		startTicker();
+	}
+
+	/**
+	 * @brief Turns echoing records to the terminal on or off (off by default).
+	 *
+	 * The terminal sink writes and flushes every record, which is what an
+	 * interactive session wants but is far slower than the buffered file sink.
+	 *
+	 * @param enabled `true` to print records on `cout`.
+	 */
+	void setConsoleEcho(const bool enabled) {
+		std::lock_guard<std::mutex> output(outputLock);
+		if( enabled == ( consoleSink != nullptr ) ) return;
+		swapSink(consoleSink, enabled ? std::make_shared<__StrLogStdoutSink>() : nullptr);
+	}
+
+	/**
+	 * @brief Attaches a sink; every text record it accepts is written to it.
+	 *
+	 * @param sink The sink (see strlogsink.hh).
+	 *
+	 * @note Example usage:
+	 * @code
+	 * auto recent = std::make_shared<__StrLogMemorySink>(100);
+	 * __strToolsLogger.addSink(recent);
+	 * // ...
+	 * for( const auto& line : recent->lines() ) std::cout << line << '\n';
+	 * @endcode
+	 */
+	void addSink(std::shared_ptr<__StrLogSink> sink) {
+		if( !sink ) return;
+		{
+			std::lock_guard<std::mutex> output(outputLock);
+			sinks.push_back(std::move(sink));
+			sinkCount.store(sinks.size(), std::memory_order_relaxed);
+		}
+		startTicker();
+	}
+
+	/**
+	 * @brief Flushes and detaches a sink added with `addSink`.
+	 */
+	void removeSink(const std::shared_ptr<__StrLogSink>& sink) {
+		if( ring ) flush();
+		std::lock_guard<std::mutex> output(outputLock);
+		auto it = std::find(sinks.begin(), sinks.end(), sink);
+		if( it == sinks.end() ) return;
+		( *it )->flush();
+		sinks.erase(it);
+		sinkCount.store(sinks.size(), std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Moves logging to a background writer thread, or back.
+	 *
+	 * In asynchronous mode `log()` only pushes the record into a lock-free
+	 * ring buffer; formatting and all I/O happen on the writer thread, which
+	 * writes records in batches. Disabling it drains the ring and joins the
+	 * writer, so nothing that was accepted is lost.
+	 *
+	 * Call it while no other thread is logging (e.g. at startup or shutdown).
+	 *
+	 * @param enabled `true` to start the writer thread, `false` to stop it.
+	 * @param capacity The number of records the ring can hold.
+	 * @param policy What `log()` does when the ring is full.
+	 *
+	 * @note Example usage:
+	 * @code
+	 * __strToolsLogger.setAsync(true, 1 << 16, __StrLogOverflow::BLOCK);
+	 * @endcode
+	 */
+	void setAsync(const bool enabled, const size_t capacity = 8192,
+		const __StrLogOverflow policy = __StrLogOverflow::DROP) {
+		stopWriterThread();
+		// The writer ticks the sinks itself; the ticker only serves synchronous mode.
+		if( !enabled ) return startTicker();
+		stopTickerThread();
+		overflow = policy;
+		ring = std::make_unique<__StrLogRing>(capacity);
+		stopWriter.store(false, std::memory_order_relaxed);
+		writer = std::thread(&__StrLogger::writerLoop, this);
+	}
+
+	/**
+	 * @brief Checks whether the logger writes from a background thread.
+	 */
+	bool isAsync() const noexcept {
+		return ring != nullptr;
+	}
+
+	/**
+	 * @brief Sets the sub-second precision of text timestamps.
+	 *
+	 * @param digits 0 (whole seconds, the default), 3 for milliseconds,
+	 * 6 for microseconds or 9 for nanoseconds; anything above 9 counts as 9.
+	 *
+	 * @note Example usage:
+	 * @code
+	 * __strToolsLogger.setTimestampPrecision(3); // 2024-08-02 14:03:27.512 [INFO] ...
+	 * @endcode
+	 */
+	void setTimestampPrecision(const unsigned digits) noexcept {
+		timestampDigits.store(digits > 9 ? 9 : digits, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Gets the number of records discarded because the ring was full.
+	 */
+	uint64_t dropped() const noexcept {
+		return droppedRecords.load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Waits until every record logged so far has been written.
+	 *
+	 * Buffered sinks write out what they hold. Only the caller waits: the
+	 * buffers are only swapped out under the output lock and written after
+	 * it is released, so other threads keep logging meanwhile. In
+	 * asynchronous mode the caller first waits for the writer to catch up
+	 * to what had been logged when `flush()` was called.
+	 */
+	void flush() {
+		if( ring ) {
+			const uint64_t target = pushed.load(std::memory_order_acquire);
+			std::unique_lock<std::mutex> lock(wakeLock);
+			wake.notify_one();
+			drained.wait(lock, [&] { return written.load(std::memory_order_acquire) >= target; });
 		}
+		flushUnlocked();
+	}
+
+	/**
+	 * @brief Switches structured (`_STRLOGF`) logging to a binary file.
+	 *
+	 * In binary mode a record is written as its call-site ID, a timestamp
+	 * and the raw argument bytes, without any text formatting; the
+	 * `strlogdecode` tool turns the file back into the usual text lines.
+	 * `_STRLOG` messages are stored as two string arguments. An empty
+	 * filename closes the binary log and returns to text logging.
+	 *
+	 * @param filename The binary log to create (truncated if it exists).
+	 *
+	 * @note Example usage:
+	 * @code
+	 * __strToolsLogger.setBinaryLogFile("strtools.bin");
+	 * // later: strlogdecode strtools.bin > strtools.log
+	 * @endcode
+	 */
+	void setBinaryLogFile(const string& filename) {
+		if( ring ) flush();
+		{
+			std::lock_guard<std::mutex> output(outputLock);
+			binaryGen.store(0, std::memory_order_release);
+			isBinaryOpen = false;
+			binaryFile.reset();
+			if( filename.empty() ) return;
+
+			auto file = std::make_shared<__StrLogFileSink>(filename);
+			if( !file->isOpen() ) {
+				cerr << "Failed to open binary log file: " << filename << endl;
+				return;
+			}
+			file->write(__StrToolsLogLvl::INFO, "STRLOGB1");
+			binaryFile = std::move(file);
+			isBinaryOpen = true;
+			// A new generation makes every call site describe itself again.
+			static uint32_t generations = 0;
+			binaryGen.store(++generations, std::memory_order_release);
+		}
+		startTicker();
+	}
+
+	/**
+	 * @brief Checks whether structured records are written in binary.
+	 */
+	bool isBinary() const noexcept {
+		return binaryGen.load(std::memory_order_acquire) != 0;
+	}
+
+	/**
+	 * @brief Identifies the current binary log file (0 if none).
+	 */
+	uint32_t binaryGeneration() const noexcept {
+		return binaryGen.load(std::memory_order_acquire);
+	}
+
+	/**
+	 * @brief Gets the calling thread's record buffer, emptied.
+	 *
+	 * Build a record in it and pass it to `commit()`; its capacity is kept
+	 * between records, so formatting a message does not allocate.
+	 */
+	static string& threadBuffer() noexcept {
+		static thread_local string buffer;
+		buffer.clear();
+		return buffer;
+	}
+
+	/**
+	 * @brief Logs a record built by the calling thread as one unit.
+	 *
+	 * The record is written (or queued) whole, so it is never interleaved
+	 * with records from other threads. `record` is left empty.
+	 *
+	 * @param level The log level of the record.
+	 * @param record The message text, or an encoded binary record (see `__StrLogBinary`).
+	 * @param binary `true` if `record` is a binary record.
+	 * @return `false` if the record was discarded: the logger is off, no binary
+	 * log is open for a binary record, or the DROP policy dropped it.
+	 *
+	 * @note Example usage:
+	 * @code
+	 * string& record = __StrLogger::threadBuffer();
+	 * record += "worker ";
+	 * record += std::to_string(id);
+	 * __strToolsLogger.commit(__StrToolsLogLvl::INFO, record);
+	 * @endcode
+	 */
+	bool commit(__StrToolsLogLvl level, string& record, const bool binary = false) {
+		if( !isLoggerEnabled.load(std::memory_order_relaxed) ) return false;
+		if( binary && !isBinaryOpen.load(std::memory_order_acquire) ) return false;
+		if( ring ) return enqueue(level, record, binary);
+		bool written = true;
+		if( binary ) {
+			std::lock_guard<std::mutex> output(outputLock);
+			written = binaryFile != nullptr;
+			if( written ) binaryFile->write(level, record);
+		} else {
+			writeRecord(level, record);
+		}
+		record.clear();
+		return written;
+	}
+
+	/**
+	 * @brief Writes an encoded binary record (see `__StrLogBinary`).
+	 *
+	 * @param record One or more complete binary log entries.
+	 */
+	void logBinary(string&& record) {
+		commit(__StrToolsLogLvl::INFO, record, true);
 	}
 
 	/**
 	 * @brief Logs a message.
 	 *
 	 * This function logs a message with the given log level. It formats the
-	 * message with a timestamp and the log level, then writes it to the log
-	 * file and the terminal.
+	 * message with a timestamp and the log level, then hands it to the sinks
+	 * (the log file, and the terminal if `setConsoleEcho(true)` was called).
 	 *
 	 * @param level The log level of the message.
 	 * @param message The message to log.
 	 */
 	void log(__StrToolsLogLvl level, const string& message) {
-		if( !isLoggerEnabled ) return;
-		// Format the message
-		string logMessage = getTimestamp() + " [" + logLevelToString(level) + "] " + message;
-		// Show the log in the terminal.
-		cout << logMessage << endl;
-		// Then, dump the message into the file.
-		if( isFileOpen ) logFile << logMessage << "\n";
+		if( !isLoggerEnabled.load(std::memory_order_relaxed) ) return;
+		if( !ring ) return writeRecord(level, message);
+		string& record = threadBuffer();
+		record = message;
+		enqueue(level, record);
+	}
+
+	/**
+	 * @brief Logs a message, taking ownership of it.
+	 *
+	 * In asynchronous mode the string is moved into the ring without a copy.
+	 *
+	 * @param level The log level of the message.
+	 * @param message The message to log.
+	 */
+	void log(__StrToolsLogLvl level, string&& message) {
+		commit(level, message);
 	}
 } __strToolsLogger;
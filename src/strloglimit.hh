@@ -0,0 +1,161 @@
+/**
+ * @file strloglimit.hh
+ * @author Ian Hylton
+ * @brief Per-call-site rate limiting and sampling for log messages.
+ * @version 1.0.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) zperk 2024
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @brief Default rate limit of `_STRLOG_LIMIT_AT` sites, in messages per second.
+ */
+#ifndef STRTOOLS_LOG_RATE
+#define STRTOOLS_LOG_RATE 10
+#endif
+
+/**
+ * @brief Default burst of `_STRLOG_LIMIT_AT` sites: messages allowed back to back.
+ */
+#ifndef STRTOOLS_LOG_BURST
+#define STRTOOLS_LOG_BURST 20
+#endif
+
+/**
+ * @brief Default sampling of `_STRLOG_LIMIT_AT` sites: 1 keeps every message,
+ * N keeps one in N before the rate limit applies.
+ */
+#ifndef STRTOOLS_LOG_SAMPLE
+#define STRTOOLS_LOG_SAMPLE 1
+#endif
+
+/**
+ * @brief How often a site that keeps suppressing messages reports their
+ * count, in milliseconds.
+ */
+#ifndef STRTOOLS_LOG_REPORT_MS
+#define STRTOOLS_LOG_REPORT_MS 1000
+#endif
+
+/**
+ * @class __StrLogLimiter
+ * @brief Token bucket plus 1-in-N sampling for one logging call site.
+ *
+ * The bucket is kept as a single "theoretical arrival time" (the GCRA form
+ * of a token bucket): a message passes if that time, advanced by one
+ * message's interval, is no more than `burst` intervals ahead of now. One
+ * CAS per message, no lock. Suppressed messages are counted, and the count
+ * is reported with the next message that gets through or, while messages
+ * keep being suppressed, once per `STRTOOLS_LOG_REPORT_MS`. A storm shows up
+ * in the log as a few messages plus a regular "N suppressed" note.
+ */
+class __StrLogLimiter {
+private:
+	using Clock = std::chrono::steady_clock;
+
+	int64_t interval;
+	int64_t tolerance;
+	uint32_t every;
+	std::atomic<int64_t> arrival { 0 };
+	std::atomic<uint64_t> seen { 0 };
+	std::atomic<uint64_t> suppressed { 0 };
+	/// @brief When the suppressed count was last reported.
+	std::atomic<int64_t> reported { 0 };
+
+	static constexpr int64_t reportPeriod = static_cast<int64_t>( STRTOOLS_LOG_REPORT_MS ) * 1000000;
+
+	static int64_t now() noexcept {
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+	}
+
+public:
+	/**
+	 * @param perSecond Sustained messages per second (0: no rate limit).
+	 * @param burst Messages allowed back to back before the rate applies.
+	 * @param sampleEvery Keep one message in this many (1: all).
+	 */
+	__StrLogLimiter(const uint32_t perSecond, const uint32_t burst, const uint32_t sampleEvery = 1) noexcept
+		: interval(perSecond ? 1000000000 / perSecond : 0),
+		tolerance(perSecond ? static_cast<int64_t>( burst ? burst - 1 : 0 ) * ( 1000000000 / perSecond ) : 0),
+		every(sampleEvery ? sampleEvery : 1), reported(now()) {}
+
+	/**
+	 * @brief Counts a suppressed message; reports the count if a report is due.
+	 *
+	 * One caller per period wins the CAS on `reported` and takes the count.
+	 */
+	uint64_t suppress(const int64_t t) noexcept {
+		suppressed.fetch_add(1, std::memory_order_relaxed);
+		int64_t last = reported.load(std::memory_order_relaxed);
+		if( t - last < reportPeriod || !reported.compare_exchange_strong(last, t, std::memory_order_relaxed) ) return 0;
+		return suppressed.exchange(0, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Decides whether a message from this site is logged.
+	 *
+	 * @param skipped Set to the number of suppressed messages to report now,
+	 * or 0. It is set when the message gets through (the count since the
+	 * last report), and also when it is suppressed but the site has not
+	 * reported for `STRTOOLS_LOG_REPORT_MS`, so a long storm is reported
+	 * periodically rather than only when it ends.
+	 * @return `true` if the message should be logged.
+	 */
+	bool allow(uint64_t& skipped) noexcept {
+		skipped = 0;
+		if( every > 1 && seen.fetch_add(1, std::memory_order_relaxed) % every != 0 ) {
+			skipped = suppress(now());
+			return false;
+		}
+		if( interval ) {
+			const int64_t t = now();
+			int64_t tat = arrival.load(std::memory_order_relaxed);
+			for( ;;) {
+				const int64_t next = ( tat > t ? tat : t ) + interval;
+				if( next - t > tolerance + interval ) {
+					skipped = suppress(t);
+					return false;
+				}
+				if( arrival.compare_exchange_weak(tat, next, std::memory_order_relaxed) ) break;
+			}
+		}
+		if( suppressed.load(std::memory_order_relaxed) ) {
+			reported.store(now(), std::memory_order_relaxed);
+			skipped = suppressed.exchange(0, std::memory_order_relaxed);
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Gets the number of suppressed messages not reported yet.
+	 */
+	uint64_t pending() const noexcept {
+		return suppressed.load(std::memory_order_relaxed);
+	}
+};
+
+/**
+ * @brief Gets the rate limiter of the call site where it is expanded.
+ *
+ * Every expansion owns a separate static `__StrLogLimiter` with the default
+ * limits, so helpers that log on behalf of their caller (such as
+ * `__StrUtilHelper::checkInvalidCharPtr`) can be limited per caller.
+ *
+ * @note Example usage:
+ * @code
+ * __StrUtilExtra.checkInvalidCharPtr(src, "toLower(char*)", _STRLOG_SITE_LIMITER());
+ * @endcode
+ */
+#define _STRLOG_SITE_LIMITER() \
+	( []() noexcept -> __StrLogLimiter& { \
+		static __StrLogLimiter __strLogLimit(STRTOOLS_LOG_RATE, STRTOOLS_LOG_BURST, STRTOOLS_LOG_SAMPLE); \
+		return __strLogLimit; \
+	}() )
@@ -0,0 +1,406 @@
+/**
+ * @file strlogsink.hh
+ * @author Ian Hylton
+ * @brief Destinations for log records: terminal, files, memory and null.
+ * @version 1.0.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) zperk 2024
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <ios>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using std::string, std::string_view;
+
+enum class __StrToolsLogLvl {
+	INFO = 0,
+	WARNING = 1,
+	ERROR = 2,
+};
+
+/**
+ * @class __StrLogSink
+ * @brief Somewhere formatted log lines go.
+ *
+ * The logger calls `write`, `tick`, `handOff` and `flush` while holding its
+ * output lock, so a sink never sees two records at once and needs no locking
+ * of its own for them. Only `drain` runs without that lock. Each sink has
+ * its own minimum level.
+ */
+class __StrLogSink {
+private:
+	std::atomic<int> minLevel { 0 };
+
+public:
+	virtual ~__StrLogSink() = default;
+
+	/**
+	 * @brief Sets the lowest level this sink receives.
+	 */
+	void setMinLevel(const __StrToolsLogLvl level) noexcept {
+		minLevel.store(static_cast<int>( level ), std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Checks whether a record of `level` goes to this sink.
+	 */
+	bool accepts(const __StrToolsLogLvl level) const noexcept {
+		return static_cast<int>( level ) >= minLevel.load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Takes one formatted line, including its trailing newline.
+	 */
+	virtual void write(__StrToolsLogLvl level, string_view line) = 0;
+
+	/**
+	 * @brief Called periodically so buffered sinks can flush by age.
+	 *
+	 * The logger calls it at least every 10 ms while a sink that flushes by
+	 * age is attached, from its writer thread in asynchronous mode and from
+	 * a ticker thread otherwise.
+	 *
+	 * @return `true` if output was handed off and the caller should `drain`.
+	 */
+	virtual bool tick() {
+		return false;
+	}
+
+	/**
+	 * @brief Checks whether the sink needs `tick` calls to flush by age.
+	 */
+	virtual bool flushesByAge() const noexcept {
+		return false;
+	}
+
+	/**
+	 * @brief Writes out anything buffered.
+	 */
+	virtual void flush() {}
+
+	/**
+	 * @brief Sets buffered output aside for `drain` (output lock held).
+	 *
+	 * A global flush calls it for every sink under the output lock, then
+	 * `drain` after releasing it, so producers never wait for the device.
+	 * By default it just flushes.
+	 */
+	virtual void handOff() {
+		flush();
+	}
+
+	/**
+	 * @brief Writes out what `handOff` set aside (output lock not held).
+	 */
+	virtual void drain() {}
+};
+
+/**
+ * @class __StrLogBufferedSink
+ * @brief A sink that collects lines and writes them out in chunks.
+ *
+ * The buffer is written out once it holds `flushBytes` bytes, or once the
+ * oldest buffered line is `flushInterval` old (checked on every write and
+ * every `tick`). `flushBytes = 0` writes every line immediately. A due
+ * `tick` only hands the buffer off; the logger drains it outside its lock.
+ *
+ * `handOff` moves the buffer to `pending`, which `drain` writes out under
+ * the sink's own device lock. A write that fills the buffer while a drain
+ * holds the device keeps buffering instead of waiting; whoever holds the
+ * device writes `pending` before `buffer`, so lines stay in order.
+ */
+class __StrLogBufferedSink : public __StrLogSink {
+private:
+	using Clock = std::chrono::steady_clock;
+
+	string buffer;
+	size_t flushBytes;
+	Clock::duration flushInterval;
+	Clock::time_point bufferedSince;
+
+	/// @brief Lines handed off for `drain`, older than everything in `buffer`.
+	string pending;
+	/// @brief Guards `pending`; only held to move it, never for I/O.
+	mutable std::mutex pendingLock;
+
+	/**
+	 * @brief Checks whether the oldest buffered line is due (output lock held).
+	 */
+	bool due() const {
+		return !buffer.empty() && flushInterval.count() != 0 && Clock::now() - bufferedSince >= flushInterval;
+	}
+
+	/**
+	 * @brief Writes `pending`, then `buffer` if `all` (device lock held).
+	 */
+	void writeHeld(const bool all) {
+		string chunk;
+		{
+			std::lock_guard<std::mutex> guard(pendingLock);
+			chunk.swap(pending);
+		}
+		if( !chunk.empty() ) writeOut(chunk.data(), chunk.size());
+		if( all && !buffer.empty() ) {
+			writeOut(buffer.data(), buffer.size());
+			buffer.clear();
+		}
+	}
+
+protected:
+	/// @brief Serializes `writeOut` and `flushDevice`.
+	std::mutex device;
+
+	/**
+	 * @brief Writes a chunk of whole lines to the device.
+	 */
+	virtual void writeOut(const char* data, size_t size) = 0;
+
+	/**
+	 * @brief Flushes the device itself (e.g. the stream's own buffer).
+	 */
+	virtual void flushDevice() {}
+
+	/**
+	 * @brief Gets the number of bytes waiting to be written.
+	 */
+	size_t buffered() const {
+		std::lock_guard<std::mutex> guard(pendingLock);
+		return buffer.size() + pending.size();
+	}
+
+	/**
+	 * @brief Writes out everything buffered and flushes the device (device lock held).
+	 */
+	void flushHeld() {
+		writeHeld(true);
+		flushDevice();
+	}
+
+public:
+	/**
+	 * @param flushBytes Write out once this many bytes are buffered (0: every line).
+	 * @param flushInterval Write out lines older than this (0: only by size).
+	 */
+	explicit __StrLogBufferedSink(const size_t flushBytes, const std::chrono::milliseconds flushInterval)
+		: flushBytes(flushBytes), flushInterval(flushInterval) {
+		buffer.reserve(flushBytes);
+	}
+
+	void write(__StrToolsLogLvl, string_view line) override {
+		if( buffer.empty() ) bufferedSince = Clock::now();
+		buffer += line;
+		if( buffer.size() >= flushBytes || due() ) {
+			// A drain in progress writes the device; keep buffering until it is done.
+			std::unique_lock<std::mutex> guard(device, std::try_to_lock);
+			if( guard.owns_lock() ) flushHeld();
+		}
+	}
+
+	bool tick() override {
+		if( !due() ) return false;
+		handOff();
+		return true;
+	}
+
+	bool flushesByAge() const noexcept override {
+		return flushBytes != 0 && flushInterval.count() != 0;
+	}
+
+	void flush() override {
+		std::lock_guard<std::mutex> guard(device);
+		flushHeld();
+	}
+
+	void handOff() override {
+		if( buffer.empty() ) return;
+		std::lock_guard<std::mutex> guard(pendingLock);
+		if( pending.empty() ) pending.swap(buffer);
+		else pending += buffer;
+		buffer.clear();
+	}
+
+	void drain() override {
+		std::lock_guard<std::mutex> guard(device);
+		writeHeld(false);
+		flushDevice();
+	}
+};
+
+/**
+ * @class __StrLogStdoutSink
+ * @brief Echoes records to the terminal.
+ *
+ * By default every line is written and flushed at once, as an interactive
+ * terminal expects.
+ */
+class __StrLogStdoutSink : public __StrLogBufferedSink {
+protected:
+	void writeOut(const char* data, const size_t size) override {
+		std::cout.write(data, static_cast<std::streamsize>( size ));
+	}
+
+	void flushDevice() override {
+		std::cout.flush();
+	}
+
+public:
+	explicit __StrLogStdoutSink(const size_t flushBytes = 0,
+		const std::chrono::milliseconds flushInterval = std::chrono::milliseconds(0))
+		: __StrLogBufferedSink(flushBytes, flushInterval) {}
+};
+
+/**
+ * @class __StrLogFileSink
+ * @brief Writes records to a file, optionally rotating it by size.
+ *
+ * With `maxBytes` set, the file is rotated before a write would take it past
+ * that size: `name` becomes `name.1`, `name.1` becomes `name.2` and so on,
+ * keeping at most `maxFiles` old files. Lines are never split across files.
+ *
+ * @note Example usage:
+ * @code
+ * // 10 MiB files, 5 old ones kept, written every 64 KiB or 1 s.
+ * auto file = std::make_shared<__StrLogFileSink>("strtools.log", 10 << 20, 5);
+ * file->setMinLevel(__StrToolsLogLvl::WARNING);
+ * __strToolsLogger.addSink(file);
+ * @endcode
+ */
+class __StrLogFileSink : public __StrLogBufferedSink {
+private:
+	string name;
+	std::ofstream file;
+	size_t maxBytes;
+	unsigned maxFiles;
+	size_t fileBytes = 0;
+
+	/**
+	 * @brief Shifts the old files up by one and starts an empty `name`.
+	 */
+	void rotate() {
+		file.close();
+		if( maxFiles == 0 ) {
+			std::remove(name.c_str());
+		} else {
+			std::remove(( name + "." + std::to_string(maxFiles) ).c_str());
+			for( unsigned i = maxFiles - 1; i >= 1; --i ) {
+				std::rename(( name + "." + std::to_string(i) ).c_str(), ( name + "." + std::to_string(i + 1) ).c_str());
+			}
+			std::rename(name.c_str(), ( name + ".1" ).c_str());
+		}
+		file.open(name, std::ios::out | std::ios::trunc | std::ios::binary);
+		fileBytes = 0;
+	}
+
+protected:
+	void writeOut(const char* data, const size_t size) override {
+		file.write(data, static_cast<std::streamsize>( size ));
+		fileBytes += size;
+	}
+
+	void flushDevice() override {
+		file.flush();
+	}
+
+public:
+	/**
+	 * @param name The file to write (truncated if it exists).
+	 * @param maxBytes Rotate before the file grows past this size (0: never).
+	 * @param maxFiles How many rotated files to keep.
+	 * @param flushBytes Write out once this many bytes are buffered.
+	 * @param flushInterval Write out lines older than this.
+	 */
+	explicit __StrLogFileSink(const string& name, const size_t maxBytes = 0, const unsigned maxFiles = 3,
+		const size_t flushBytes = 64 << 10,
+		const std::chrono::milliseconds flushInterval = std::chrono::milliseconds(1000))
+		: __StrLogBufferedSink(flushBytes, flushInterval), name(name), maxBytes(maxBytes), maxFiles(maxFiles) {
+		file.open(name, std::ios::out | std::ios::trunc | std::ios::binary);
+	}
+
+	~__StrLogFileSink() override {
+		flush();
+	}
+
+	/**
+	 * @brief Checks whether the file could be opened.
+	 */
+	bool isOpen() const noexcept {
+		return file.is_open();
+	}
+
+	void write(__StrToolsLogLvl level, string_view line) override {
+		if( maxBytes && fileBytes + buffered() + line.size() > maxBytes && fileBytes + buffered() > 0 ) {
+			std::lock_guard<std::mutex> guard(device);
+			flushHeld();
+			rotate();
+		}
+		__StrLogBufferedSink::write(level, line);
+	}
+};
+
+/**
+ * @class __StrLogMemorySink
+ * @brief Keeps the most recent lines in memory (e.g. for tests or crash dumps).
+ */
+class __StrLogMemorySink : public __StrLogSink {
+private:
+	mutable std::mutex lock;
+	std::vector<string> ring;
+	size_t next = 0;
+	size_t count = 0;
+
+public:
+	/**
+	 * @param capacity The number of lines kept; older ones are overwritten.
+	 */
+	explicit __StrLogMemorySink(const size_t capacity = 1024) : ring(capacity ? capacity : 1) {}
+
+	void write(__StrToolsLogLvl, string_view line) override {
+		std::lock_guard<std::mutex> guard(lock);
+		// Drop the newline; the slot's buffer is reused once the ring wraps.
+		ring[next].assign(line.data(), line.size() - ( !line.empty() && line.back() == '\n' ));
+		next = ( next + 1 ) % ring.size();
+		if( count < ring.size() ) ++count;
+	}
+
+	/**
+	 * @brief Gets the kept lines, oldest first, without their newlines.
+	 */
+	std::vector<string> lines() const {
+		std::lock_guard<std::mutex> guard(lock);
+		std::vector<string> out;
+		out.reserve(count);
+		for( size_t i = 0; i < count; ++i ) out.push_back(ring[( next + ring.size() - count + i ) % ring.size()]);
+		return out;
+	}
+
+	/**
+	 * @brief Forgets every kept line.
+	 */
+	void clear() {
+		std::lock_guard<std::mutex> guard(lock);
+		next = 0;
+		count = 0;
+	}
+};
+
+/**
+ * @class __StrLogNullSink
+ * @brief Discards everything; measures the cost of logging without I/O.
+ */
+class __StrLogNullSink : public __StrLogSink {
+public:
+	void write(__StrToolsLogLvl, string_view) override {}
+};
@@ -0,0 +1,207 @@
+/**
+ * @file strpool.hh
+ * @author Ian Hylton
+ * @brief Thread-local pool for fixed-size character buffers.
+ * @version 1.0.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) zperk 2024
+ *
+ */
+
+#pragma once
+
+#include "strlogger.hh"
+#include "strutil.hh"
+#include "strutilhelper.hh"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+using std::to_string;
+
+/**
+ * @brief Deleter that hands a pooled buffer back to the calling thread's pool.
+ *
+ * The deleter remembers the size class the buffer was taken from. Buffers
+ * that are larger than every size class (or that were created without a pool)
+ * are released with `delete[]`.
+ */
+struct __StrPoolDeleter {
+	/// @brief Size class of the buffer, or `noClass` for plain `new char[]`.
+	uint8_t sizeClass = noClass;
+
+	static constexpr uint8_t noClass = 0xFF;
+
+	void operator()(char* p) const noexcept;
+};
+
+#define pooledStr std::unique_ptr<char[], __StrPoolDeleter>
+
+/**
+ * @class __StrBufferPool
+ * @brief Per-thread free lists of character buffers, grouped by size class.
+ *
+ * Size classes are powers of two from `minClassSize` to
+ * `minClassSize << (classCount - 1)`. Every thread owns its own free lists,
+ * so taking and returning a buffer never touches a lock or the global
+ * allocator once the lists are warm. A list keeps at most `maxCached`
+ * buffers; extra buffers go back to `delete[]`.
+ */
+class __StrBufferPool {
+public:
+	static constexpr uint8_t classCount = 8;
+	static constexpr uint64_t minClassSize = 64;
+	static constexpr uint32_t maxCached = 32;
+
+private:
+	struct Node {
+		Node* next;
+	};
+
+	Node* heads[classCount] = {};
+	uint32_t counts[classCount] = {};
+
+	// Set once this thread's pool is gone, so late frees skip it.
+	static inline thread_local bool destroyed = false;
+
+	__StrBufferPool() = default;
+
+public:
+	__StrBufferPool(const __StrBufferPool&) = delete;
+	__StrBufferPool& operator=(const __StrBufferPool&) = delete;
+
+	/**
+	 * @brief Frees every cached buffer when the thread exits.
+	 */
+	~__StrBufferPool() {
+		for( uint8_t c = 0; c < classCount; ++c ) {
+			while( heads[c] ) {
+				Node* n = heads[c];
+				heads[c] = n->next;
+				delete[] reinterpret_cast<char*>( n );
+			}
+		}
+		destroyed = true;
+	}
+
+	/**
+	 * @brief Returns the pool of the calling thread.
+	 */
+	static __StrBufferPool& local() noexcept {
+		thread_local __StrBufferPool pool;
+		return pool;
+	}
+
+	/**
+	 * @brief Checks whether the calling thread's pool was already destroyed.
+	 */
+	static bool isDestroyed() noexcept {
+		return destroyed;
+	}
+
+	/**
+	 * @brief Gets the smallest size class that fits `size` bytes.
+	 *
+	 * @param size The requested size in bytes.
+	 * @return The size class, or `__StrPoolDeleter::noClass` if none fits.
+	 */
+	static uint8_t sizeClassOf(const uint64_t size) noexcept {
+		uint64_t classSize = minClassSize;
+		for( uint8_t c = 0; c < classCount; ++c, classSize <<= 1 ) {
+			if( size <= classSize ) return c;
+		}
+		return __StrPoolDeleter::noClass;
+	}
+
+	/**
+	 * @brief Gets the size in bytes of a size class.
+	 */
+	static uint64_t classSizeOf(const uint8_t sizeClass) noexcept {
+		return minClassSize << sizeClass;
+	}
+
+	/**
+	 * @brief Takes a buffer of the given size class.
+	 *
+	 * @param sizeClass A valid size class.
+	 * @return A buffer of `classSizeOf(sizeClass)` bytes.
+	 */
+	char* acquire(const uint8_t sizeClass) {
+		if( Node* n = heads[sizeClass] ) {
+			heads[sizeClass] = n->next;
+			--counts[sizeClass];
+			return reinterpret_cast<char*>( n );
+		}
+		return new char[classSizeOf(sizeClass)];
+	}
+
+	/**
+	 * @brief Returns a buffer to its size class.
+	 *
+	 * @param p The buffer, taken from any thread's pool.
+	 * @param sizeClass The size class `p` was taken from.
+	 */
+	void recycle(char* p, const uint8_t sizeClass) noexcept {
+		if( counts[sizeClass] >= maxCached ) {
+			delete[] p;
+			return;
+		}
+		Node* n = reinterpret_cast<Node*>( p );
+		n->next = heads[sizeClass];
+		heads[sizeClass] = n;
+		++counts[sizeClass];
+	}
+
+	/**
+	 * @brief Gets the number of buffers cached for a size class.
+	 */
+	uint32_t cached(const uint8_t sizeClass) const noexcept {
+		return counts[sizeClass];
+	}
+};
+
+void __StrPoolDeleter::operator()(char* p) const noexcept {
+	if( p == nullptr ) return;
+	if( sizeClass == noClass || __StrBufferPool::isDestroyed() ) {
+		delete[] p;
+		return;
+	}
+	__StrBufferPool::local().recycle(p, sizeClass);
+}
+
+namespace strUtil {
+	/**
+	 * @brief Takes a character buffer from the thread-local pool.
+	 *
+	 * The buffer holds at least `size` bytes and starts with a null
+	 * terminator. When the returned `pooledStr` is destroyed, the buffer goes
+	 * back to the pool of the thread that destroys it instead of the global
+	 * allocator. Sizes above the largest size class fall back to `new char[]`.
+	 *
+	 * @param size The minimum size of the buffer in bytes.
+	 * @return A `pooledStr` owning the buffer.
+	 *
+	 * @note Example usage:
+	 * @code
+	 * auto input = strUtil::makePooledStr(256);
+	 * strUtil::userInputHandler(input.get(), 256);
+	 * @endcode
+	 */
+	static pooledStr makePooledStr(uint64_t size) {
+		_STRLOGF("makePooledStr(): taking pooled string with size: {}", size);
+		if( size == 0 ) size = 1;
+
+		__StrPoolDeleter d;
+		d.sizeClass = __StrBufferPool::sizeClassOf(size);
+		// Oversized requests (and threads past their pool) use `new char[]`.
+		if( d.sizeClass != __StrPoolDeleter::noClass && __StrBufferPool::isDestroyed() )
+			d.sizeClass = __StrPoolDeleter::noClass;
+
+		char* p = d.sizeClass == __StrPoolDeleter::noClass
+			? new char[size]
+			: __StrBufferPool::local().acquire(d.sizeClass);
+		p[0] = '\0';
+		return pooledStr(p, d);
+	}
+}
@@ -0,0 +1,418 @@
+/**
+ * @file strprofile.hh
+ * @author Ian Hylton
+ * @brief Optional per-operation call counts, byte volumes and latency histograms.
+ * @version 1.0.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) zperk 2024
+ *
+ */
+
+#pragma once
+
+#include "stralloc.hh"
+#include "strtrace.hh"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+using std::string;
+
+/**
+ * @brief Log-linear latency buckets, in the style of an HDR histogram.
+ *
+ * Values below 16 ns get a bucket each; every power of two above that is
+ * split into 16 buckets, so a bucket is never wider than 1/16 (6.25%) of the
+ * values it holds. The last bucket collects everything from about 39 hours up.
+ */
+struct __StrLatencyBuckets {
+	static constexpr unsigned subBuckets = 16;
+	static constexpr unsigned maxExponent = 47;
+	static constexpr size_t count = ( maxExponent - 3 ) * subBuckets + subBuckets;
+
+	/**
+	 * @brief Gets the bucket holding `ns`.
+	 */
+	static size_t index(const uint64_t ns) noexcept {
+		if( ns < subBuckets ) return static_cast<size_t>( ns );
+#if defined(_MSC_VER) && !defined(__clang__)
+		unsigned long top;
+		_BitScanReverse64(&top, ns);
+		const unsigned e = static_cast<unsigned>( top );
+#else
+		const unsigned e = 63u - static_cast<unsigned>( __builtin_clzll(ns) );
+#endif
+		if( e > maxExponent ) return count - 1;
+		return ( e - 3 ) * subBuckets + ( ( ns >> ( e - 4 ) ) & ( subBuckets - 1 ) );
+	}
+
+	/**
+	 * @brief Gets the smallest value that falls into bucket `i`.
+	 */
+	static uint64_t lowerBound(const size_t i) noexcept {
+		if( i < subBuckets ) return i;
+		const unsigned e = static_cast<unsigned>( i / subBuckets ) + 3;
+		return ( subBuckets + i % subBuckets ) << ( e - 4 );
+	}
+};
+
+/**
+ * @brief Merged statistics of one operation (see `__StrProfiler::snapshot`).
+ */
+struct __StrOpSummary {
+	string name;
+	uint64_t calls = 0;
+	uint64_t bytes = 0;
+	uint64_t totalNs = 0;
+	uint64_t maxNs = 0;
+	/// @brief Call counts per `__StrLatencyBuckets` bucket.
+	std::vector<uint64_t> buckets = std::vector<uint64_t>(__StrLatencyBuckets::count);
+
+	/**
+	 * @brief Gets the mean latency in nanoseconds.
+	 */
+	double meanNs() const noexcept {
+		return calls ? static_cast<double>( totalNs ) / static_cast<double>( calls ) : 0.0;
+	}
+
+	/**
+	 * @brief Gets an upper bound of the `q` quantile (0-1) of the latency.
+	 */
+	uint64_t percentile(const double q) const noexcept {
+		if( !calls ) return 0;
+		uint64_t rank = static_cast<uint64_t>( q * static_cast<double>( calls ) + 0.5 );
+		if( rank < 1 ) rank = 1;
+		uint64_t seen = 0;
+		for( size_t i = 0; i < buckets.size(); ++i ) {
+			seen += buckets[i];
+			if( seen >= rank ) {
+				const uint64_t upper = i + 1 < buckets.size() ? __StrLatencyBuckets::lowerBound(i + 1) - 1 : maxNs;
+				return upper < maxNs ? upper : maxNs;
+			}
+		}
+		return maxNs;
+	}
+};
+
+/**
+ * @class __StrProfiler
+ * @brief Collects per-operation statistics in thread-local storage.
+ *
+ * Each thread counts into its own tables, so recording a call is a handful
+ * of uncontended relaxed stores. `snapshot()` merges every live thread and
+ * every thread that has exited; a thread folds its tables into a shared
+ * "retired" table when it ends.
+ *
+ * Operations are recorded by `_STROP` when the library is built with
+ * `STRTOOLS_PROFILE` defined; otherwise `_STROP` compiles to nothing and
+ * the tables stay empty.
+ *
+ * @note Example usage:
+ * @code
+ * // g++ -DSTRTOOLS_PROFILE ...
+ * auto s = strTools::concatStr("Hello, ", "World!");
+ * __StrProfiler::dumpText(std::cout);
+ * @endcode
+ */
+class __StrProfiler {
+private:
+	/// @brief Distinct operation names that can be tracked.
+	static constexpr size_t maxOps = 128;
+
+	struct Counters {
+		std::atomic<uint64_t> calls { 0 };
+		std::atomic<uint64_t> bytes { 0 };
+		std::atomic<uint64_t> totalNs { 0 };
+		std::atomic<uint64_t> maxNs { 0 };
+		std::atomic<uint64_t> buckets[__StrLatencyBuckets::count] = {};
+	};
+
+	struct ThreadTables;
+
+	struct Registry {
+		std::mutex lock;
+		std::vector<string> names;
+		std::vector<ThreadTables*> threads;
+		std::unique_ptr<Counters> retired[maxOps];
+	};
+
+	static Registry& registry() {
+		static Registry r;
+		return r;
+	}
+
+	/// @brief One thread's counters; only that thread writes them.
+	struct ThreadTables {
+		std::atomic<Counters*> ops[maxOps] = {};
+
+		ThreadTables() {
+			Registry& r = registry();
+			std::lock_guard<std::mutex> guard(r.lock);
+			r.threads.push_back(this);
+		}
+
+		~ThreadTables() {
+			Registry& r = registry();
+			std::lock_guard<std::mutex> guard(r.lock);
+			for( size_t id = 0; id < maxOps; ++id ) {
+				Counters* c = ops[id].load(std::memory_order_relaxed);
+				if( !c ) continue;
+				if( !r.retired[id] ) r.retired[id] = std::make_unique<Counters>();
+				add(*r.retired[id], *c);
+				delete c;
+			}
+			for( size_t i = 0; i < r.threads.size(); ++i ) {
+				if( r.threads[i] == this ) {
+					r.threads.erase(r.threads.begin() + static_cast<std::ptrdiff_t>( i ));
+					break;
+				}
+			}
+		}
+	};
+
+	static ThreadTables& local() {
+		static thread_local ThreadTables tables;
+		return tables;
+	}
+
+	/**
+	 * @brief Adds `v` to a counter only the calling thread writes.
+	 */
+	static void bump(std::atomic<uint64_t>& c, const uint64_t v) noexcept {
+		c.store(c.load(std::memory_order_relaxed) + v, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Adds `from` into `to` (registry lock held).
+	 */
+	static void add(Counters& to, const Counters& from) noexcept {
+		to.calls.fetch_add(from.calls.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		to.bytes.fetch_add(from.bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		to.totalNs.fetch_add(from.totalNs.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		const uint64_t m = from.maxNs.load(std::memory_order_relaxed);
+		if( m > to.maxNs.load(std::memory_order_relaxed) ) to.maxNs.store(m, std::memory_order_relaxed);
+		for( size_t i = 0; i < __StrLatencyBuckets::count; ++i ) {
+			const uint64_t n = from.buckets[i].load(std::memory_order_relaxed);
+			if( n ) to.buckets[i].fetch_add(n, std::memory_order_relaxed);
+		}
+	}
+
+	/**
+	 * @brief Adds `from` into a summary.
+	 */
+	static void add(__StrOpSummary& to, const Counters& from) noexcept {
+		to.calls += from.calls.load(std::memory_order_relaxed);
+		to.bytes += from.bytes.load(std::memory_order_relaxed);
+		to.totalNs += from.totalNs.load(std::memory_order_relaxed);
+		const uint64_t m = from.maxNs.load(std::memory_order_relaxed);
+		if( m > to.maxNs ) to.maxNs = m;
+		for( size_t i = 0; i < __StrLatencyBuckets::count; ++i ) to.buckets[i] += from.buckets[i].load(std::memory_order_relaxed);
+	}
+
+	static void clear(Counters& c) noexcept {
+		c.calls.store(0, std::memory_order_relaxed);
+		c.bytes.store(0, std::memory_order_relaxed);
+		c.totalNs.store(0, std::memory_order_relaxed);
+		c.maxNs.store(0, std::memory_order_relaxed);
+		for( auto& b : c.buckets ) b.store(0, std::memory_order_relaxed);
+	}
+
+public:
+	/**
+	 * @brief Gets the ID of an operation name, registering it on first use.
+	 *
+	 * Call sites cache the ID in a static, so this runs once per site.
+	 *
+	 * @return The ID, or `maxOps` if the table is full (the calls are then ignored).
+	 */
+	static uint32_t opId(const char* name) {
+		Registry& r = registry();
+		std::lock_guard<std::mutex> guard(r.lock);
+		for( size_t i = 0; i < r.names.size(); ++i ) {
+			if( r.names[i] == name ) return static_cast<uint32_t>( i );
+		}
+		if( r.names.size() == maxOps ) return maxOps;
+		r.names.emplace_back(name);
+		return static_cast<uint32_t>( r.names.size() - 1 );
+	}
+
+	/**
+	 * @brief Records one call of operation `id` on the calling thread.
+	 *
+	 * @param id The operation (see `opId`).
+	 * @param bytes The number of input bytes the call processed.
+	 * @param ns How long the call took.
+	 */
+	static void record(const uint32_t id, const uint64_t bytes, const uint64_t ns) {
+		if( id >= maxOps ) return;
+		ThreadTables& t = local();
+		Counters* c = t.ops[id].load(std::memory_order_relaxed);
+		if( !c ) {
+			c = new Counters();
+			t.ops[id].store(c, std::memory_order_release);
+		}
+		bump(c->calls, 1);
+		bump(c->bytes, bytes);
+		bump(c->totalNs, ns);
+		if( ns > c->maxNs.load(std::memory_order_relaxed) ) c->maxNs.store(ns, std::memory_order_relaxed);
+		bump(c->buckets[__StrLatencyBuckets::index(ns)], 1);
+	}
+
+	/**
+	 * @brief Merges the statistics of every thread.
+	 *
+	 * @return One summary per operation that was called, in registration order.
+	 */
+	static std::vector<__StrOpSummary> snapshot() {
+		Registry& r = registry();
+		std::lock_guard<std::mutex> guard(r.lock);
+		std::vector<__StrOpSummary> out;
+		for( size_t id = 0; id < r.names.size(); ++id ) {
+			__StrOpSummary s;
+			s.name = r.names[id];
+			if( r.retired[id] ) add(s, *r.retired[id]);
+			for( ThreadTables* t : r.threads ) {
+				const Counters* c = t->ops[id].load(std::memory_order_acquire);
+				if( c ) add(s, *c);
+			}
+			if( s.calls ) out.push_back(std::move(s));
+		}
+		return out;
+	}
+
+	/**
+	 * @brief Zeroes every counter.
+	 *
+	 * Calls recorded by other threads while this runs may be partly lost.
+	 */
+	static void reset() {
+		Registry& r = registry();
+		std::lock_guard<std::mutex> guard(r.lock);
+		for( size_t id = 0; id < maxOps; ++id ) {
+			if( r.retired[id] ) clear(*r.retired[id]);
+			for( ThreadTables* t : r.threads ) {
+				Counters* c = t->ops[id].load(std::memory_order_acquire);
+				if( c ) clear(*c);
+			}
+		}
+	}
+
+	/**
+	 * @brief Writes a table of calls, bytes and latency percentiles.
+	 */
+	static void dumpText(std::ostream& out) {
+		out << std::left << std::setw(20) << "operation" << std::right
+			<< std::setw(12) << "calls" << std::setw(14) << "bytes"
+			<< std::setw(11) << "mean ns" << std::setw(11) << "p50 ns" << std::setw(11) << "p90 ns"
+			<< std::setw(11) << "p99 ns" << std::setw(12) << "max ns" << "\n";
+		for( const auto& s : snapshot() ) {
+			out << std::left << std::setw(20) << s.name << std::right
+				<< std::setw(12) << s.calls << std::setw(14) << s.bytes
+				<< std::setw(11) << std::fixed << std::setprecision(1) << s.meanNs()
+				<< std::setw(11) << s.percentile(0.5) << std::setw(11) << s.percentile(0.9)
+				<< std::setw(11) << s.percentile(0.99) << std::setw(12) << s.maxNs << "\n";
+		}
+	}
+
+	/**
+	 * @brief Writes the statistics as JSON, including the non-empty buckets.
+	 *
+	 * Each bucket is written as `[lowest ns, count]`.
+	 */
+	static void dumpJson(std::ostream& out) {
+		out << "{\"ops\":[";
+		bool first = true;
+		for( const auto& s : snapshot() ) {
+			out << ( first ? "" : "," ) << "\n{\"name\":\"" << s.name << "\",\"calls\":" << s.calls
+				<< ",\"bytes\":" << s.bytes << ",\"mean_ns\":" << std::fixed << std::setprecision(1) << s.meanNs()
+				<< ",\"p50_ns\":" << s.percentile(0.5) << ",\"p90_ns\":" << s.percentile(0.9)
+				<< ",\"p99_ns\":" << s.percentile(0.99) << ",\"max_ns\":" << s.maxNs << ",\"buckets\":[";
+			bool firstBucket = true;
+			for( size_t i = 0; i < s.buckets.size(); ++i ) {
+				if( !s.buckets[i] ) continue;
+				out << ( firstBucket ? "" : "," ) << "[" << __StrLatencyBuckets::lowerBound(i) << "," << s.buckets[i] << "]";
+				firstBucket = false;
+			}
+			out << "]}";
+			first = false;
+		}
+		out << "\n]}\n";
+	}
+};
+
+/**
+ * @class __StrOpScope
+ * @brief Times the enclosing scope and records it as one call of an operation.
+ */
+class __StrOpScope {
+private:
+	using Clock = std::chrono::steady_clock;
+
+	uint32_t id;
+	uint64_t bytes;
+	Clock::time_point start;
+
+public:
+	__StrOpScope(const uint32_t id, const uint64_t bytes) noexcept : id(id), bytes(bytes), start(Clock::now()) {}
+
+	~__StrOpScope() {
+		const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+		__StrProfiler::record(id, bytes, static_cast<uint64_t>( ns ));
+	}
+
+	__StrOpScope(const __StrOpScope&) = delete;
+	__StrOpScope& operator=(const __StrOpScope&) = delete;
+};
+
+/**
+ * @brief Records the rest of the enclosing scope as one call of `name`.
+ *
+ * `name` must be a string literal and `bytes` the input size the call
+ * processes. With `STRTOOLS_PROFILE` the call is added to the operation's
+ * statistics; with `STRTOOLS_TRACE` it is also traced as a span (see
+ * `__StrTracer`); with `STRTOOLS_TRACK_ALLOC` the allocations it makes are
+ * charged to it (see `__StrAllocTracker`). With none of them, the macro
+ * compiles to nothing and `bytes` is not evaluated.
+ *
+ * @note Example usage:
+ * @code
+ * uniqueStr concatStr(string_view s1, string_view s2) {
+ *     _STROP("concatStr", s1.size() + s2.size());
+ *     ...
+ * }
+ * @endcode
+ */
+#if defined( STRTOOLS_PROFILE ) || defined( STRTOOLS_TRACK_ALLOC )
+#define __STROP_ID(name) static const uint32_t __strOpId = __StrProfiler::opId(name)
+#else
+#define __STROP_ID(name) static_cast<void>( 0 )
+#endif
+
+#ifdef STRTOOLS_PROFILE
+#define __STROP_PROFILE(bytes) const __StrOpScope __strOpScope(__strOpId, static_cast<uint64_t>( bytes ))
+#else
+#define __STROP_PROFILE(bytes) static_cast<void>( 0 )
+#endif
+
+#ifdef STRTOOLS_TRACK_ALLOC
+#define __STROP_ALLOC(name) const __StrAllocScope __strAllocScope(__strOpId, name)
+#else
+#define __STROP_ALLOC(name) static_cast<void>( 0 )
+#endif
+
+#define _STROP(name, bytes) \
+	__STROP_ID(name); \
+	__STROP_ALLOC(name); \
+	__STROP_PROFILE(bytes); \
+	__STRSPAN_BYTES(name, bytes)
@@ -0,0 +1,253 @@
+/**
+ * @file strrc.hh
+ * @author Ian Hylton
+ * @brief Immutable reference-counted strings with copy-on-write.
+ * @version 1.0.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) zperk 2024
+ *
+ */
+
+#pragma once
+
+#include "strlogger.hh"
+#include "strutil.hh"
+#include "strutilhelper.hh"
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <string_view>
+
+using std::string_view, std::to_string;
+
+/**
+ * @class rcStr
+ * @brief A shared string whose refcount, length and bytes live in one allocation.
+ *
+ * `sharedStr` keeps the characters and the `shared_ptr` control block in two
+ * separate places and does not know its length. An `rcStr` allocates a
+ * single block `[refcount | length | characters | '\0']`, so copying it is one
+ * atomic increment and reading it touches one cache line for short strings.
+ *
+ * The characters are shared and treated as immutable. `mutableData()` (and the
+ * `strUtil` functions that modify an `rcStr` in place) copy the block first
+ * only when another `rcStr` still refers to it.
+ *
+ * `rcStr` converts to `std::string_view`, so every `strTools` function
+ * accepts it directly.
+ *
+ * @note Example usage:
+ * @code
+ * rcStr a = strUtil::makeRcStr("Hello, World!");
+ * rcStr b = a;           // no allocation, refcount is now 2
+ * strUtil::toUpper(b);   // b is copied once, then changed in place
+ * int64_t i = strTools::findSubStr(a, "world"); // 7
+ * @endcode
+ */
+class rcStr {
+private:
+	struct Header {
+		std::atomic<uint32_t> refs;
+		uint64_t length;
+
+		char* chars() noexcept {
+			return reinterpret_cast<char*>( this + 1 );
+		}
+	};
+
+	Header* h;
+
+	static Header* allocate(const uint64_t n) {
+		void* block = ::operator new(sizeof(Header) + n + 1);
+		Header* r = new ( block ) Header;
+		r->refs.store(1, std::memory_order_relaxed);
+		r->length = n;
+		r->chars()[n] = '\0';
+		return r;
+	}
+
+	void release() noexcept {
+		if( h && h->refs.fetch_sub(1, std::memory_order_acq_rel) == 1 ) {
+			h->~Header();
+			::operator delete(h);
+		}
+		h = nullptr;
+	}
+
+public:
+	/**
+	 * @brief Constructs an empty string without allocating.
+	 */
+	rcStr() noexcept : h(nullptr) {}
+
+	/**
+	 * @brief Constructs a string holding a copy of `s`.
+	 *
+	 * @param s The characters to copy. Embedded NULs are allowed.
+	 */
+	explicit rcStr(string_view s) : h(nullptr) {
+		if( s.empty() ) return;
+		h = allocate(s.size());
+		memcpy(h->chars(), s.data(), s.size());
+	}
+
+	rcStr(const rcStr& other) noexcept : h(other.h) {
+		if( h ) h->refs.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	rcStr(rcStr&& other) noexcept : h(other.h) {
+		other.h = nullptr;
+	}
+
+	rcStr& operator=(const rcStr& other) noexcept {
+		if( h == other.h ) return *this;
+		if( other.h ) other.h->refs.fetch_add(1, std::memory_order_relaxed);
+		release();
+		h = other.h;
+		return *this;
+	}
+
+	rcStr& operator=(rcStr&& other) noexcept {
+		if( this == &other ) return *this;
+		release();
+		h = other.h;
+		other.h = nullptr;
+		return *this;
+	}
+
+	~rcStr() {
+		release();
+	}
+
+	/**
+	 * @brief Returns a pointer to the null-terminated characters.
+	 */
+	const char* c_str() const noexcept {
+		return h ? h->chars() : "";
+	}
+
+	/**
+	 * @brief Returns a pointer to the characters.
+	 */
+	const char* data() const noexcept {
+		return c_str();
+	}
+
+	/**
+	 * @brief Returns the number of characters (excluding the terminator).
+	 */
+	uint64_t size() const noexcept {
+		return h ? h->length : 0;
+	}
+
+	/**
+	 * @brief Checks whether the string has no characters.
+	 */
+	bool empty() const noexcept {
+		return size() == 0;
+	}
+
+	/**
+	 * @brief Gets the number of `rcStr` objects sharing these characters.
+	 */
+	uint32_t useCount() const noexcept {
+		return h ? h->refs.load(std::memory_order_acquire) : 0;
+	}
+
+	/**
+	 * @brief Returns the string as a `std::string_view`.
+	 */
+	string_view view() const noexcept {
+		return string_view(c_str(), size());
+	}
+
+	/**
+	 * @brief Views the string as a `std::string_view`.
+	 */
+	operator string_view() const noexcept {
+		return view();
+	}
+
+	/**
+	 * @brief Returns writable characters, copying them first if they are shared.
+	 *
+	 * The copy happens only when the refcount is above one; a string that is
+	 * already unique is changed in place.
+	 *
+	 * @return A pointer to `size()` writable characters, or `nullptr` if empty.
+	 */
+	char* mutableData() {
+		if( !h ) return nullptr;
+		if( h->refs.load(std::memory_order_acquire) != 1 ) {
+			Header* copy = allocate(h->length);
+			memcpy(copy->chars(), h->chars(), h->length);
+			release();
+			h = copy;
+		}
+		return h->chars();
+	}
+
+	/**
+	 * @brief Copies the string into a new `uniqueStr`.
+	 */
+	uniqueStr toUniqueStr() const {
+		uniqueStr r = std::make_unique<char[]>(
+			static_cast<size_t>( size() ) + 1
+		);
+		memcpy(r.get(), c_str(), size() + 1);
+		return r;
+	}
+};
+
+namespace strUtil {
+	/**
+	 * @brief Creates an `rcStr` from a C-string.
+	 *
+	 * Unlike `makeSharedStr`, the refcount and length share the allocation
+	 * with the characters.
+	 *
+	 * @param src The source C-string to be copied.
+	 * @return An `rcStr` containing a copy of the source string.
+	 *
+	 * @note Example usage:
+	 * @code
+	 * auto myString = strUtil::makeRcStr("Hello, World!");
+	 * @endcode
+	 */
+	static rcStr makeRcStr(const char* src) {
+		_STRLOG("makeRcStr()", "creating rc string");
+		// If the pointer is a nullptr, return an empty string.
+		if( __StrUtilExtra.checkInvalidCharPtr(src, "makeRcStr()", _STRLOG_SITE_LIMITER()) ) return rcStr();
+		return rcStr(string_view(src));
+	}
+
+	/**
+	 * @brief Converts an `rcStr` to lowercase (copy-on-write).
+	 *
+	 * The characters are copied first only if another `rcStr` shares them.
+	 *
+	 * @param s The string to be modified.
+	 */
+	void toLower(rcStr& s) {
+		_STRLOGF("toLower(rcStr): {}", s.size());
+		if( s.empty() ) return;
+		toLower(s.mutableData(), s.size());
+	}
+
+	/**
+	 * @brief Converts an `rcStr` to uppercase (copy-on-write).
+	 *
+	 * The characters are copied first only if another `rcStr` shares them.
+	 *
+	 * @param s The string to be modified.
+	 */
+	void toUpper(rcStr& s) {
+		_STRLOGF("toUpper(rcStr): {}", s.size());
+		if( s.empty() ) return;
+		toUpper(s.mutableData(), s.size());
+	}
+}
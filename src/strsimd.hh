@@ -0,0 +1,606 @@
+/**
+ * @file strsimd.hh
+ * @author Ian Hylton
+ * @brief Vectorized kernels with runtime CPU dispatch.
+ * @version 1.0.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) zperk 2024
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+#define __STRSIMD_X86 1
+#define __STRSIMD_TARGET(isa) __attribute__((target(isa)))
+#include <immintrin.h>
+#elif defined(_MSC_VER) && ( defined(_M_X64) || ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 ) )
+#define __STRSIMD_X86 1
+#define __STRSIMD_TARGET(isa)
+#include <immintrin.h>
+#else
+#define __STRSIMD_X86 0
+#define __STRSIMD_TARGET(isa)
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+/**
+ * @brief Shuffle indices that pack the kept bytes of an 8-byte group.
+ *
+ * `index[keep]` lists, in order, the positions of the set bits of `keep`;
+ * the unused tail is 0x80, which `pshufb` turns into zero.
+ */
+struct __StrSimdCompactTable {
+	alignas(8) unsigned char index[256][8];
+
+	constexpr __StrSimdCompactTable() noexcept : index() {
+		for( unsigned keep = 0; keep < 256; ++keep ) {
+			unsigned w = 0;
+			for( unsigned k = 0; k < 8; ++k ) {
+				if( keep >> k & 1 ) index[keep][w++] = static_cast<unsigned char>( k );
+			}
+			for( ; w < 8; ++w ) index[keep][w] = 0x80;
+		}
+	}
+};
+
+/**
+ * @class __StrSimd
+ * @brief SIMD kernels shared by `strUtil` and `strTools`.
+ *
+ * Every kernel has a portable scalar version and, on x86, SSE2, AVX2 and
+ * AVX-512BW versions. The widest version the CPU supports is picked once, on
+ * first use, and called through a function pointer afterwards. MSVC builds
+ * use SSE2 only.
+ */
+class __StrSimd {
+public:
+	/// @brief Non-ASCII fallback, e.g. `tolower` or `toupper`.
+	using byteFn = int ( * )( int );
+	using caseFn = void ( * )( char*, const char*, size_t, bool, byteFn );
+	using prefixFn = size_t ( * )( const char*, size_t );
+	using mismatchFn = size_t ( * )( const char*, const char*, size_t );
+
+	/**
+	 * @brief A 256-entry byte mapping plus a delete set, split by high nibble.
+	 *
+	 * `map[h][l]` is the replacement for byte `h * 16 + l`, and `drop[h][l]`
+	 * is 0xFF when that byte must be removed. Sixteen-entry rows are exactly
+	 * what one `pshufb` can look up.
+	 *
+	 * `finish()` derives what the vector kernels use: the rows that are not
+	 * the identity (only those are looked up, so a sparse mapping such as
+	 * ROT13 costs 4 lookups instead of 16), and the delete set as a
+	 * nibble-split bitmap (3 lookups whatever its size).
+	 */
+	struct ByteTable {
+		alignas(16) unsigned char map[16][16];
+		alignas(16) unsigned char drop[16][16];
+		/// @brief Bit `h & 7` of `dropBits[h >> 3][l]` is set when byte `h * 16 + l` is dropped.
+		alignas(16) unsigned char dropBits[2][16];
+		/// @brief The high nibbles whose row is not the identity, ascending.
+		unsigned char mapRows[16];
+		unsigned char mapRowCount;
+		bool hasDrops;
+
+		/**
+		 * @brief Recomputes the derived fields after `map` or `drop` changed.
+		 */
+		void finish() noexcept {
+			mapRowCount = 0;
+			hasDrops = false;
+			memset(dropBits, 0, sizeof(dropBits));
+			for( unsigned h = 0; h < 16; ++h ) {
+				bool identity = true;
+				for( unsigned l = 0; l < 16; ++l ) {
+					if( map[h][l] != h * 16 + l ) identity = false;
+					if( drop[h][l] ) {
+						dropBits[h >> 3][l] |= static_cast<unsigned char>( 1u << ( h & 7 ) );
+						hasDrops = true;
+					}
+				}
+				if( !identity ) mapRows[mapRowCount++] = static_cast<unsigned char>( h );
+			}
+		}
+	};
+
+	using translateFn = size_t ( * )( char*, const char*, size_t, const ByteTable& );
+
+	enum class Level {
+		SCALAR = 0,
+		SSE2 = 1,
+		AVX2 = 2,
+		AVX512 = 3,
+	};
+
+	/**
+	 * @brief Gets the widest instruction set available on this CPU.
+	 */
+	static Level level() noexcept {
+		static const Level detected = detect();
+		return detected;
+	}
+
+	/**
+	 * @brief Converts ASCII letters to lowercase or uppercase in place.
+	 *
+	 * ASCII letters are converted 16-64 bytes at a time with branchless range
+	 * compares. Bytes above 0x7F are passed one by one to `fallback` (if any),
+	 * which keeps locale-specific single-byte mappings working.
+	 *
+	 * @param s The characters to convert.
+	 * @param n The number of characters.
+	 * @param upper `true` for uppercase, `false` for lowercase.
+	 * @param fallback Mapping for non-ASCII bytes, or `nullptr` to keep them.
+	 */
+	static void asciiCase(char* s, const size_t n, const bool upper, byteFn fallback = nullptr) noexcept {
+		static const caseFn fn = pickCase();
+		fn(s, s, n, upper, fallback);
+	}
+
+	/**
+	 * @brief Copies ASCII text to `dst` converted to lowercase or uppercase.
+	 *
+	 * The same kernels as `asciiCase`, reading `src` and storing to `dst`,
+	 * so the text is only passed over once. Bytes above 0x7F are copied.
+	 *
+	 * @param dst Destination of `n` characters; may be equal to `src`.
+	 * @param src The characters to convert.
+	 * @param n The number of characters.
+	 * @param upper `true` for uppercase, `false` for lowercase.
+	 */
+	static void asciiCaseCopy(char* dst, const char* src, const size_t n, const bool upper) noexcept {
+		static const caseFn fn = pickCase();
+		fn(dst, src, n, upper, nullptr);
+	}
+
+	/**
+	 * @brief Counts the leading ASCII bytes (those below 0x80).
+	 *
+	 * Checks 16-32 bytes at a time with `movemask`, so UTF-8 code can skip
+	 * plain ASCII runs at memory speed.
+	 *
+	 * @param s The characters to scan.
+	 * @param n The number of characters.
+	 * @return The index of the first byte above 0x7F, or `n` if there is none.
+	 */
+	static size_t asciiPrefix(const char* s, const size_t n) noexcept {
+		static const prefixFn fn = pickPrefix();
+		return fn(s, n);
+	}
+
+	/**
+	 * @brief Finds the first position where two ranges differ, ignoring ASCII case.
+	 *
+	 * Both ranges are lowercased in registers 16-32 bytes at a time and
+	 * compared with `pcmpeqb`; nothing is copied.
+	 *
+	 * @param a The first range.
+	 * @param b The second range.
+	 * @param n The number of characters to compare in each.
+	 * @return The index of the first mismatch, or `n` if the ranges are equal.
+	 */
+	static size_t foldMismatch(const char* a, const char* b, const size_t n) noexcept {
+		static const mismatchFn fn = pickMismatch();
+		return fn(a, b, n);
+	}
+
+	/**
+	 * @brief Lowercases the ASCII letters of eight packed bytes (SWAR).
+	 *
+	 * Bytes above 0x7F are left unchanged.
+	 */
+	static uint64_t foldWord(const uint64_t w) noexcept {
+		const uint64_t high = 0x8080808080808080ull;
+		const uint64_t low7 = w & ~high;
+		// Bit 7 of each byte: set when the low 7 bits are >= 'A' and <= 'Z'.
+		const uint64_t geA = low7 + 0x3F3F3F3F3F3F3F3Full; // 0x80 - 'A'
+		const uint64_t gtZ = low7 + 0x2525252525252525ull; // 0x80 - 'Z' - 1
+		const uint64_t upper = geA & ~gtZ & ~w & high;
+		return w | ( upper >> 2 );
+	}
+
+	/**
+	 * @brief Maps every byte through a table and removes the dropped ones.
+	 *
+	 * The SSSE3 and AVX2 versions look up 16 or 32 bytes at a time with one
+	 * `pshufb` per high nibble. Blocks without dropped bytes are stored as a
+	 * whole; the rest are compacted byte by byte.
+	 *
+	 * @param dst Destination; may be equal to `src` for in-place use.
+	 * @param src Source characters.
+	 * @param n Number of source characters.
+	 * @param t The compiled table.
+	 * @return The number of characters written to `dst`.
+	 */
+	static size_t translate(char* dst, const char* src, const size_t n, const ByteTable& t) noexcept {
+		static const translateFn fn = pickTranslate();
+		return fn(dst, src, n, t);
+	}
+
+private:
+	static Level detect() noexcept {
+#if __STRSIMD_X86 && defined(__GNUC__)
+		__builtin_cpu_init();
+		if( __builtin_cpu_supports("avx512bw") ) return Level::AVX512;
+		if( __builtin_cpu_supports("avx2") ) return Level::AVX2;
+		return Level::SSE2;
+#elif __STRSIMD_X86
+		return Level::SSE2;
+#else
+		return Level::SCALAR;
+#endif
+	}
+
+	static caseFn pickCase() noexcept {
+		switch( level() ) {
+#if __STRSIMD_X86 && defined(__GNUC__)
+		case Level::AVX512: return caseAvx512;
+		case Level::AVX2: return caseAvx2;
+#endif
+#if __STRSIMD_X86
+		case Level::SSE2: return caseSse2;
+#endif
+		default: return caseScalar;
+		} // switch( level() )
+	}
+
+	static prefixFn pickPrefix() noexcept {
+		switch( level() ) {
+#if __STRSIMD_X86 && defined(__GNUC__)
+		case Level::AVX512:
+		case Level::AVX2: return prefixAvx2;
+#endif
+#if __STRSIMD_X86
+		case Level::SSE2: return prefixSse2;
+#endif
+		default: return prefixScalar;
+		} // switch( level() )
+	}
+
+	static mismatchFn pickMismatch() noexcept {
+		switch( level() ) {
+#if __STRSIMD_X86 && defined(__GNUC__)
+		case Level::AVX512:
+		case Level::AVX2: return mismatchAvx2;
+#endif
+#if __STRSIMD_X86
+		case Level::SSE2: return mismatchSse2;
+#endif
+		default: return mismatchScalar;
+		} // switch( level() )
+	}
+
+	static translateFn pickTranslate() noexcept {
+#if __STRSIMD_X86 && defined(__GNUC__)
+		if( level() >= Level::AVX2 ) return translateAvx2Any;
+		if( __builtin_cpu_supports("ssse3") ) return translateSsse3Any;
+#endif
+		return translateScalar;
+	}
+
+	static size_t translateScalar(char* dst, const char* src, const size_t n, const ByteTable& t) noexcept {
+		size_t w = 0;
+		for( size_t i = 0; i < n; ++i ) {
+			const unsigned char c = (unsigned char) src[i];
+			if( t.hasDrops && t.drop[c >> 4][c & 0x0F] ) continue;
+			dst[w++] = static_cast<char>( t.map[c >> 4][c & 0x0F] );
+		}
+		return w;
+	}
+
+	static size_t prefixScalar(const char* s, const size_t n) noexcept {
+		size_t i = 0;
+		for( ; i + 8 <= n; i += 8 ) {
+			uint64_t word;
+			memcpy(&word, s + i, 8);
+			if( word & 0x8080808080808080ull ) break;
+		}
+		while( i < n && (unsigned char) s[i] < 0x80 ) ++i;
+		return i;
+	}
+
+	static size_t mismatchScalar(const char* a, const char* b, const size_t n) noexcept {
+		size_t i = 0;
+		for( ; i + 8 <= n; i += 8 ) {
+			uint64_t x, y;
+			memcpy(&x, a + i, 8);
+			memcpy(&y, b + i, 8);
+			if( foldWord(x) != foldWord(y) ) break;
+		}
+		for( ; i < n; ++i ) {
+			const uint64_t x = (unsigned char) a[i], y = (unsigned char) b[i];
+			if( foldWord(x) != foldWord(y) ) return i;
+		}
+		return n;
+	}
+
+	static constexpr __StrSimdCompactTable compactTable {};
+
+	/// @brief Converts one byte; letters only, no branches.
+	static char caseByte(const char c, const bool upper) noexcept {
+		const unsigned char first = upper ? 'a' : 'A';
+		const unsigned char isLetter = (unsigned char) ( (unsigned char) c - first ) < 26;
+		return static_cast<char>( c ^ ( isLetter << 5 ) );
+	}
+
+	static void caseScalar(char* d, const char* s, const size_t n, const bool upper, byteFn fallback) noexcept {
+		for( size_t i = 0; i < n; ++i ) {
+			if( fallback && (unsigned char) s[i] > 0x7F ) d[i] = static_cast<char>( fallback((unsigned char) s[i]) );
+			else d[i] = caseByte(s[i], upper);
+		}
+	}
+
+	/// @brief Index of the lowest set bit of a non-zero mask.
+	static int lowestBit(const uint64_t mask) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+		unsigned long i;
+		_BitScanForward64(&i, mask);
+		return static_cast<int>( i );
+#elif defined(_MSC_VER) && !defined(__clang__)
+		// 32-bit targets have no 64-bit scan: try the low half, then the high one.
+		unsigned long i;
+		if( _BitScanForward(&i, static_cast<uint32_t>( mask )) ) return static_cast<int>( i );
+		_BitScanForward(&i, static_cast<uint32_t>( mask >> 32 ));
+		return static_cast<int>( i ) + 32;
+#else
+		return __builtin_ctzll(mask);
+#endif
+	}
+
+	/// @brief Applies `fallback` to the bytes flagged in `highBits`.
+	static void fixHighBytes(char* s, uint64_t highBits, byteFn fallback) noexcept {
+		while( highBits ) {
+			const int i = lowestBit(highBits);
+			s[i] = static_cast<char>( fallback((unsigned char) s[i]) );
+			highBits &= highBits - 1;
+		}
+	}
+
+#if __STRSIMD_X86
+	__STRSIMD_TARGET("sse2")
+	static void caseSse2(char* d, const char* s, const size_t n, const bool upper, byteFn fallback) noexcept {
+		// Signed compares: bytes above 0x7F are negative and never match.
+		const __m128i lo = _mm_set1_epi8(upper ? 'a' - 1 : 'A' - 1);
+		const __m128i hi = _mm_set1_epi8(upper ? 'z' + 1 : 'Z' + 1);
+		const __m128i bit = _mm_set1_epi8(0x20);
+		size_t i = 0;
+		for( ; i + 16 <= n; i += 16 ) {
+			__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>( s + i ));
+			const __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(v, lo), _mm_cmplt_epi8(v, hi));
+			v = _mm_xor_si128(v, _mm_and_si128(letters, bit));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>( d + i ), v);
+			if( fallback ) {
+				const uint64_t high = static_cast<uint32_t>( _mm_movemask_epi8(v) );
+				if( high ) fixHighBytes(d + i, high, fallback);
+			}
+		}
+		caseScalar(d + i, s + i, n - i, upper, fallback);
+	}
+
+	__STRSIMD_TARGET("sse2")
+	static size_t prefixSse2(const char* s, const size_t n) noexcept {
+		size_t i = 0;
+		for( ; i + 16 <= n; i += 16 ) {
+			const int high = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>( s + i )));
+			if( high ) return i + lowestBit(static_cast<uint32_t>( high ));
+		}
+		return i + prefixScalar(s + i, n - i);
+	}
+
+	/// @brief Lowercases the ASCII letters of 16 bytes.
+	__STRSIMD_TARGET("sse2")
+	static __m128i foldSse2(const __m128i v) noexcept {
+		const __m128i letters = _mm_and_si128(
+			_mm_cmpgt_epi8(v, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('Z' + 1))
+		);
+		return _mm_or_si128(v, _mm_and_si128(letters, _mm_set1_epi8(0x20)));
+	}
+
+	__STRSIMD_TARGET("sse2")
+	static size_t mismatchSse2(const char* a, const char* b, const size_t n) noexcept {
+		size_t i = 0;
+		for( ; i + 16 <= n; i += 16 ) {
+			const __m128i x = foldSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>( a + i )));
+			const __m128i y = foldSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>( b + i )));
+			const uint32_t diff = ~static_cast<uint32_t>( _mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) ) & 0xFFFF;
+			if( diff ) return i + lowestBit(diff);
+		}
+		return i + mismatchScalar(a + i, b + i, n - i);
+	}
+#endif
+
+#if __STRSIMD_X86 && defined(__GNUC__)
+	/**
+	 * @brief Writes the bytes of `v` flagged in `keep` (bit k = byte k) to `dst`, packed.
+	 *
+	 * Each 8-byte half is packed with one `compactTable` shuffle. Up to 16
+	 * bytes are stored, so `dst` needs that much room even if fewer are kept.
+	 *
+	 * @return The number of bytes kept.
+	 */
+	__STRSIMD_TARGET("ssse3")
+	static size_t compact16(char* dst, const __m128i v, const uint32_t keep) noexcept {
+		const unsigned low = keep & 0xFF, high = ( keep >> 8 ) & 0xFF;
+		const __m128i shuffle = _mm_unpacklo_epi64(
+			_mm_loadl_epi64(reinterpret_cast<const __m128i*>( compactTable.index[low] )),
+			_mm_add_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>( compactTable.index[high] )), _mm_set1_epi8(8))
+		);
+		const __m128i packed = _mm_shuffle_epi8(v, shuffle);
+		const size_t w = static_cast<size_t>( __builtin_popcount(low) );
+		_mm_storel_epi64(reinterpret_cast<__m128i*>( dst ), packed);
+		_mm_storel_epi64(reinterpret_cast<__m128i*>( dst + w ), _mm_unpackhi_epi64(packed, packed));
+		return w + static_cast<size_t>( __builtin_popcount(high) );
+	}
+
+	/**
+	 * @brief Maps and filters 16 bytes at a time.
+	 *
+	 * Only the non-identity rows are looked up (one `pshufb` each, blended in
+	 * where the high nibble matches). Dropped bytes are found with the
+	 * nibble-split bitmap and squeezed out with `compact16`. A block never
+	 * writes past its own end, so `dst` may equal `src`.
+	 */
+	template<bool Drops>
+	__STRSIMD_TARGET("ssse3")
+	static size_t translateSsse3(char* dst, const char* src, const size_t n, const ByteTable& t) noexcept {
+		const __m128i nibble = _mm_set1_epi8(0x0F);
+		const __m128i bitOf = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+		const __m128i dropLow = _mm_load_si128(reinterpret_cast<const __m128i*>( t.dropBits[0] ));
+		const __m128i dropHigh = _mm_load_si128(reinterpret_cast<const __m128i*>( t.dropBits[1] ));
+		size_t i = 0, w = 0;
+		for( ; i + 16 <= n; i += 16 ) {
+			const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>( src + i ));
+			const __m128i lo = _mm_and_si128(v, nibble);
+			const __m128i hi = _mm_and_si128(_mm_srli_epi16(v, 4), nibble);
+			__m128i r = v;
+			for( unsigned k = 0; k < t.mapRowCount; ++k ) {
+				const unsigned char h = t.mapRows[k];
+				const __m128i row = _mm_cmpeq_epi8(hi, _mm_set1_epi8(static_cast<char>( h )));
+				const __m128i mapped = _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>( t.map[h] )), lo);
+				r = _mm_or_si128(_mm_andnot_si128(row, r), _mm_and_si128(row, mapped));
+			}
+			if constexpr( Drops ) {
+				const __m128i upper = _mm_cmpgt_epi8(hi, _mm_set1_epi8(7));
+				const __m128i bits = _mm_or_si128(
+					_mm_andnot_si128(upper, _mm_shuffle_epi8(dropLow, lo)),
+					_mm_and_si128(upper, _mm_shuffle_epi8(dropHigh, lo))
+				);
+				const __m128i bit = _mm_shuffle_epi8(bitOf, hi);
+				const uint32_t dropped = static_cast<uint32_t>( _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(bits, bit), bit)) );
+				if( dropped ) {
+					w += compact16(dst + w, r, ~dropped & 0xFFFF);
+					continue;
+				}
+			}
+			_mm_storeu_si128(reinterpret_cast<__m128i*>( dst + w ), r);
+			w += 16;
+		}
+		return w + translateScalar(dst + w, src + i, n - i, t);
+	}
+
+	/**
+	 * @brief Maps and filters 32 bytes at a time (see `translateSsse3`).
+	 */
+	template<bool Drops>
+	__STRSIMD_TARGET("avx2")
+	static size_t translateAvx2(char* dst, const char* src, const size_t n, const ByteTable& t) noexcept {
+		const __m256i nibble = _mm256_set1_epi8(0x0F);
+		const __m256i bitOf = _mm256_broadcastsi128_si256(
+			_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128)
+		);
+		const __m256i dropLow = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>( t.dropBits[0] )));
+		const __m256i dropHigh = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>( t.dropBits[1] )));
+		size_t i = 0, w = 0;
+		for( ; i + 32 <= n; i += 32 ) {
+			const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>( src + i ));
+			const __m256i lo = _mm256_and_si256(v, nibble);
+			const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble);
+			__m256i r = v;
+			for( unsigned k = 0; k < t.mapRowCount; ++k ) {
+				const unsigned char h = t.mapRows[k];
+				const __m256i row = _mm256_cmpeq_epi8(hi, _mm256_set1_epi8(static_cast<char>( h )));
+				const __m256i map = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>( t.map[h] )));
+				r = _mm256_blendv_epi8(r, _mm256_shuffle_epi8(map, lo), row);
+			}
+			if constexpr( Drops ) {
+				const __m256i bits = _mm256_blendv_epi8(
+					_mm256_shuffle_epi8(dropLow, lo), _mm256_shuffle_epi8(dropHigh, lo),
+					_mm256_cmpgt_epi8(hi, _mm256_set1_epi8(7))
+				);
+				const __m256i bit = _mm256_shuffle_epi8(bitOf, hi);
+				const uint32_t dropped = static_cast<uint32_t>( _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(bits, bit), bit)) );
+				if( dropped ) {
+					w += compact16(dst + w, _mm256_castsi256_si128(r), ~dropped & 0xFFFF);
+					w += compact16(dst + w, _mm256_extracti128_si256(r, 1), ~dropped >> 16);
+					continue;
+				}
+			}
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>( dst + w ), r);
+			w += 32;
+		}
+		return w + translateScalar(dst + w, src + i, n - i, t);
+	}
+
+	static size_t translateSsse3Any(char* dst, const char* src, const size_t n, const ByteTable& t) noexcept {
+		return t.hasDrops ? translateSsse3<true>(dst, src, n, t) : translateSsse3<false>(dst, src, n, t);
+	}
+
+	static size_t translateAvx2Any(char* dst, const char* src, const size_t n, const ByteTable& t) noexcept {
+		return t.hasDrops ? translateAvx2<true>(dst, src, n, t) : translateAvx2<false>(dst, src, n, t);
+	}
+
+	__STRSIMD_TARGET("avx2")
+	static void caseAvx2(char* d, const char* s, const size_t n, const bool upper, byteFn fallback) noexcept {
+		const __m256i lo = _mm256_set1_epi8(upper ? 'a' - 1 : 'A' - 1);
+		const __m256i hi = _mm256_set1_epi8(upper ? 'z' + 1 : 'Z' + 1);
+		const __m256i bit = _mm256_set1_epi8(0x20);
+		size_t i = 0;
+		for( ; i + 32 <= n; i += 32 ) {
+			__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>( s + i ));
+			const __m256i letters = _mm256_and_si256(_mm256_cmpgt_epi8(v, lo), _mm256_cmpgt_epi8(hi, v));
+			v = _mm256_xor_si256(v, _mm256_and_si256(letters, bit));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>( d + i ), v);
+			if( fallback ) {
+				const uint64_t high = static_cast<uint32_t>( _mm256_movemask_epi8(v) );
+				if( high ) fixHighBytes(d + i, high, fallback);
+			}
+		}
+		caseSse2(d + i, s + i, n - i, upper, fallback);
+	}
+
+	__STRSIMD_TARGET("avx2")
+	static size_t prefixAvx2(const char* s, const size_t n) noexcept {
+		size_t i = 0;
+		for( ; i + 32 <= n; i += 32 ) {
+			const int high = _mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>( s + i )));
+			if( high ) return i + lowestBit(static_cast<uint32_t>( high ));
+		}
+		return i + prefixSse2(s + i, n - i);
+	}
+
+	__STRSIMD_TARGET("avx2")
+	static size_t mismatchAvx2(const char* a, const char* b, const size_t n) noexcept {
+		const __m256i lo = _mm256_set1_epi8('A' - 1);
+		const __m256i hi = _mm256_set1_epi8('Z' + 1);
+		const __m256i bit = _mm256_set1_epi8(0x20);
+		size_t i = 0;
+		for( ; i + 32 <= n; i += 32 ) {
+			__m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>( a + i ));
+			__m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>( b + i ));
+			x = _mm256_or_si256(x, _mm256_and_si256(_mm256_and_si256(_mm256_cmpgt_epi8(x, lo), _mm256_cmpgt_epi8(hi, x)), bit));
+			y = _mm256_or_si256(y, _mm256_and_si256(_mm256_and_si256(_mm256_cmpgt_epi8(y, lo), _mm256_cmpgt_epi8(hi, y)), bit));
+			const uint32_t diff = ~static_cast<uint32_t>( _mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)) );
+			if( diff ) return i + lowestBit(diff);
+		}
+		return i + mismatchSse2(a + i, b + i, n - i);
+	}
+
+	__STRSIMD_TARGET("avx512bw")
+	static void caseAvx512(char* d, const char* s, const size_t n, const bool upper, byteFn fallback) noexcept {
+		const __m512i lo = _mm512_set1_epi8(upper ? 'a' - 1 : 'A' - 1);
+		const __m512i hi = _mm512_set1_epi8(upper ? 'z' + 1 : 'Z' + 1);
+		const __m512i bit = _mm512_set1_epi8(0x20);
+		size_t i = 0;
+		for( ; i + 64 <= n; i += 64 ) {
+			__m512i v = _mm512_loadu_si512(s + i);
+			const __mmask64 letters = _mm512_cmpgt_epi8_mask(v, lo) & _mm512_cmpgt_epi8_mask(hi, v);
+			v = _mm512_xor_si512(v, _mm512_maskz_mov_epi8(letters, bit));
+			_mm512_storeu_si512(d + i, v);
+			if( fallback ) {
+				const uint64_t high = _mm512_movepi8_mask(v);
+				if( high ) fixHighBytes(d + i, high, fallback);
+			}
+		}
+		caseAvx2(d + i, s + i, n - i, upper, fallback);
+	}
+#endif
+};
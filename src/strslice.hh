@@ -0,0 +1,158 @@
+/**
+ * @file strslice.hh
+ * @author Ian Hylton
+ * @brief Zero-copy views over shared strings.
+ * @version 1.0.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) zperk 2024
+ *
+ */
+
+#pragma once
+
+#include "strlogger.hh"
+#include "strutil.hh"
+#include "strutilhelper.hh"
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+
+using std::string, std::to_string;
+
+/**
+ * @class strSlice
+ * @brief A `[offset, length)` view over a `sharedStr` buffer.
+ *
+ * A slice never copies the characters it refers to. It stores a `sharedStr`
+ * built with the `shared_ptr` aliasing constructor, so it points at the first
+ * character of the region while sharing ownership of the whole parent buffer.
+ * The parent stays alive for as long as any slice of it exists.
+ *
+ * @note A slice is NOT null-terminated. Use `size()` together with `data()`,
+ * or `toUniqueStr()` when a C-string is required.
+ *
+ * @note Example usage:
+ * @code
+ * auto parent = strUtil::makeSharedStr("Hello, World!");
+ * strSlice all(parent);
+ * auto world = all.slice(7, 5); // "World", no allocation
+ * @endcode
+ */
+class strSlice {
+private:
+	sharedStr ptr;
+	uint64_t length;
+
+	strSlice(const sharedStr& parent, const char* at, uint64_t len) noexcept
+		: ptr(parent, const_cast<char*>( at )), length(len) {}
+
+public:
+	/**
+	 * @brief Constructs an empty slice.
+	 */
+	strSlice() noexcept : ptr(), length(0) {}
+
+	/**
+	 * @brief Constructs a slice covering the whole shared string.
+	 *
+	 * @param s The shared string to view.
+	 */
+	strSlice(const sharedStr& s) noexcept : ptr(s), length(s ? strlen(s.get()) : 0) {}
+
+	/**
+	 * @brief Constructs a slice over `[i, i + j)` of a shared string.
+	 *
+	 * @param s The shared string to view.
+	 * @param i Position of the first character to include.
+	 * @param j Number of characters to include from i.
+	 * @throws std::runtime_error if indices are out of bounds.
+	 */
+	strSlice(const sharedStr& s, const uint64_t i, const uint64_t j) : strSlice(strSlice(s).slice(i, j)) {}
+
+	/**
+	 * @brief Returns a pointer to the first character of the slice.
+	 */
+	const char* data() const noexcept {
+		return ptr.get();
+	}
+
+	/**
+	 * @brief Returns the number of characters in the slice.
+	 */
+	uint64_t size() const noexcept {
+		return length;
+	}
+
+	/**
+	 * @brief Checks whether the slice has no characters.
+	 */
+	bool empty() const noexcept {
+		return length == 0;
+	}
+
+	/**
+	 * @brief Returns the character at position `i` (unchecked).
+	 */
+	char operator[](const uint64_t i) const noexcept {
+		return ptr.get()[i];
+	}
+
+	/**
+	 * @brief Returns the slice as a `std::string_view`.
+	 */
+	std::string_view view() const noexcept {
+		return length ? std::string_view(ptr.get(), length) : std::string_view();
+	}
+
+	/**
+	 * @brief Views the slice as a `std::string_view`.
+	 *
+	 * This lets every `string_view` overload in `strTools` accept slices
+	 * directly.
+	 */
+	operator std::string_view() const noexcept {
+		return view();
+	}
+
+	/**
+	 * @brief Returns the aliasing pointer that keeps the parent alive.
+	 */
+	const sharedStr& owner() const noexcept {
+		return ptr;
+	}
+
+	/**
+	 * @brief Extracts a sub-slice without copying.
+	 *
+	 * The bounds rules are the same as `strTools::subStr`.
+	 *
+	 * @param i Position of the first character to include (index 0 = first character).
+	 * @param j Number of characters to extract from i.
+	 * @return A slice sharing the same parent buffer.
+	 * @throws std::runtime_error if indices are out of bounds.
+	 */
+	strSlice slice(const uint64_t i, const uint64_t j) const {
+		__StrUtilExtra.checkLogicErrors(
+			i >= length || i + j > length,
+			"The indices 'i' and 'j' must be non-negative and "
+			"the length must not exceed the length of the original string.",
+			_STRLOG_SITE_LIMITER()
+		);
+		return strSlice(ptr, ptr.get() + i, j);
+	}
+
+	/**
+	 * @brief Copies the slice into a new null-terminated `uniqueStr`.
+	 */
+	uniqueStr toUniqueStr() const {
+		uniqueStr r = std::make_unique<char[]>(
+			static_cast<size_t>( length ) + 1
+		);
+		if( length ) memcpy(r.get(), ptr.get(), length);
+		r[length] = '\0';
+		return r;
+	}
+};
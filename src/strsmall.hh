@@ -0,0 +1,286 @@
+/**
+ * @file strsmall.hh
+ * @author Ian Hylton
+ * @brief Small-string-optimized result type.
+ * @version 1.0.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) zperk 2024
+ *
+ */
+
+#pragma once
+
+#include "strutil.hh"
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <string_view>
+#include <utility>
+
+/**
+ * @class smallStr
+ * @brief A null-terminated string with inline storage for short values.
+ *
+ * Strings of up to `inlineCapacity` characters live inside the object itself,
+ * so tokens, keys and short substrings cost no heap allocation. Longer strings
+ * spill to a `new char[]` buffer, which is kept and reused when the object is
+ * assigned a new value that fits. The length is always stored, so embedded NUL
+ * characters are preserved.
+ *
+ * Every `strTools` function that produces a string has an overload that writes
+ * into a `smallStr&`, and `smallStr` converts to `std::string_view`, so it can
+ * be passed back into any `strTools` function.
+ *
+ * A `smallStr` can also take its heap buffer from a `std::pmr::memory_resource`.
+ * With a `std::pmr::monotonic_buffer_resource`, all temporaries of a request
+ * are released together when the arena is destroyed.
+ *
+ * @note Example usage:
+ * @code
+ * smallStr key;
+ * strTools::subStr(key, "user:1234:name", 5, 4); // no heap allocation
+ * auto owned = std::move(key).toUniqueStr();      // only when needed
+ * @endcode
+ */
+class smallStr {
+public:
+	/// @brief Number of characters stored without a heap allocation.
+	static constexpr uint64_t inlineCapacity = 23;
+
+private:
+	char* ptr;
+	uint64_t length;
+	uint64_t capacity;
+	std::pmr::memory_resource* resource;
+	char buf[inlineCapacity + 1];
+
+	bool isHeap() const noexcept {
+		return ptr != buf;
+	}
+
+	char* allocate(const uint64_t n) {
+		if( resource ) return static_cast<char*>( resource->allocate(n + 1, 1) );
+		return new char[n + 1];
+	}
+
+	void release() noexcept {
+		if( isHeap() ) {
+			if( resource ) resource->deallocate(ptr, capacity + 1, 1);
+			else delete[] ptr;
+		}
+		ptr = buf;
+		capacity = inlineCapacity;
+	}
+
+public:
+	/**
+	 * @brief Constructs an empty string.
+	 */
+	smallStr() noexcept : ptr(buf), length(0), capacity(inlineCapacity), resource(nullptr) {
+		buf[0] = '\0';
+	}
+
+	/**
+	 * @brief Constructs an empty string that allocates from `mr`.
+	 *
+	 * @param mr The memory resource used for heap storage, or `nullptr` for
+	 * `new char[]`. It must outlive the string.
+	 */
+	explicit smallStr(std::pmr::memory_resource* mr) noexcept : smallStr() {
+		resource = mr;
+	}
+
+	/**
+	 * @brief Constructs a string holding a copy of `s`.
+	 *
+	 * @param s The characters to copy.
+	 */
+	explicit smallStr(std::string_view s) : smallStr() {
+		assign(s);
+	}
+
+	smallStr(const smallStr& other) : smallStr() {
+		assign(other.view());
+	}
+
+	smallStr(smallStr&& other) noexcept : smallStr(other.resource) {
+		*this = std::move(other);
+	}
+
+	smallStr& operator=(const smallStr& other) {
+		if( this != &other ) assign(other.view());
+		return *this;
+	}
+
+	smallStr& operator=(smallStr&& other) {
+		if( this == &other ) return *this;
+		if( other.isHeap() && other.resource != resource ) {
+			// Buffers from another resource can't change owner.
+			assign(other.view());
+			return *this;
+		}
+		release();
+		if( other.isHeap() ) {
+			// Steal the heap buffer.
+			ptr = other.ptr;
+			capacity = other.capacity;
+			other.ptr = other.buf;
+			other.capacity = inlineCapacity;
+		} else {
+			memcpy(buf, other.buf, other.length + 1);
+		}
+		length = other.length;
+		other.length = 0;
+		other.buf[0] = '\0';
+		return *this;
+	}
+
+	~smallStr() {
+		release();
+	}
+
+	/**
+	 * @brief Prepares the string to hold exactly `n` characters.
+	 *
+	 * The previous contents are discarded. Inline storage is used when `n`
+	 * fits, otherwise the current heap buffer is reused when it is large
+	 * enough. The terminator at `n` is already written.
+	 *
+	 * @param n The new length.
+	 * @return A writable pointer to `n` characters.
+	 */
+	char* reset(const uint64_t n) {
+		if( n > capacity ) {
+			char* p = allocate(n);
+			release();
+			ptr = p;
+			capacity = n;
+		} else if( n <= inlineCapacity && isHeap() ) {
+			release();
+		}
+		length = n;
+		ptr[n] = '\0';
+		return ptr;
+	}
+
+	/**
+	 * @brief Shortens the string to `n` characters, keeping its storage.
+	 *
+	 * @param n The new length; values above `size()` are ignored.
+	 */
+	void truncate(const uint64_t n) noexcept {
+		if( n >= length ) return;
+		length = n;
+		ptr[n] = '\0';
+	}
+
+	/**
+	 * @brief Replaces the contents with a copy of `s`.
+	 *
+	 * @param s The characters to copy. It may view this string.
+	 */
+	void assign(std::string_view s) {
+		if( !s.empty() && s.data() >= ptr && s.data() <= ptr + length ) {
+			// `s` views our own buffer; `memmove` keeps it intact.
+			memmove(ptr, s.data(), s.size());
+			length = s.size();
+			ptr[length] = '\0';
+			return;
+		}
+		char* d = reset(s.size());
+		if( !s.empty() ) memcpy(d, s.data(), s.size());
+	}
+
+	/**
+	 * @brief Returns the memory resource, or `nullptr` for `new char[]`.
+	 */
+	std::pmr::memory_resource* memoryResource() const noexcept {
+		return resource;
+	}
+
+	/**
+	 * @brief Returns a pointer to the null-terminated characters.
+	 */
+	const char* c_str() const noexcept {
+		return ptr;
+	}
+
+	/**
+	 * @brief Returns a pointer to the characters.
+	 */
+	const char* data() const noexcept {
+		return ptr;
+	}
+
+	/**
+	 * @brief Returns a writable pointer to the characters.
+	 */
+	char* data() noexcept {
+		return ptr;
+	}
+
+	/**
+	 * @brief Returns the number of characters (excluding the terminator).
+	 */
+	uint64_t size() const noexcept {
+		return length;
+	}
+
+	/**
+	 * @brief Checks whether the string has no characters.
+	 */
+	bool empty() const noexcept {
+		return length == 0;
+	}
+
+	/**
+	 * @brief Checks whether the characters are stored inline.
+	 */
+	bool isInline() const noexcept {
+		return !isHeap();
+	}
+
+	/**
+	 * @brief Returns the string as a `std::string_view`.
+	 */
+	std::string_view view() const noexcept {
+		return std::string_view(ptr, length);
+	}
+
+	/**
+	 * @brief Views the string as a `std::string_view`.
+	 */
+	operator std::string_view() const noexcept {
+		return view();
+	}
+
+	/**
+	 * @brief Copies the string into a new `uniqueStr`.
+	 */
+	uniqueStr toUniqueStr() const& {
+		uniqueStr r = std::make_unique<char[]>(
+			static_cast<size_t>( length ) + 1
+		);
+		memcpy(r.get(), ptr, length + 1);
+		return r;
+	}
+
+	/**
+	 * @brief Converts the string into a `uniqueStr`.
+	 *
+	 * A heap buffer from `new char[]` is handed over without copying; inline
+	 * strings and memory-resource buffers are copied. The string is left
+	 * empty.
+	 */
+	uniqueStr toUniqueStr() && {
+		if( !isHeap() || resource ) return static_cast<const smallStr&>( *this ).toUniqueStr();
+		uniqueStr r(ptr);
+		ptr = buf;
+		capacity = inlineCapacity;
+		length = 0;
+		buf[0] = '\0';
+		return r;
+	}
+};
@@ -15,15 +15,27 @@
 #pragma once
 
 #include "strlogger.hh"
+#include "strprofile.hh"
+#include "strsimd.hh"
+#include "strslice.hh"
+#include "strsmall.hh"
 #include "strutil.hh"
 #include "strutilhelper.hh"
+#include <cctype>
 #include <cstdint>
 #include <cstring>
+#include <initializer_list>
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <string.h>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 using std::string;
+using std::string_view;
 
 /**
  * @namespace strTools
@@ -34,8 +46,165 @@ using std::string;
  * deletion, finding substrings, and replacement of substrings. These functions
  * use C-style strings and return results in `uniqueStr` to ensure
  * proper memory management.
+ *
+ * Every function also has a `std::string_view` overload. Those overloads never
+ * call `strlen`, accept buffers that are not null-terminated and handle
+ * embedded NUL characters; the C-string overloads measure each input exactly
+ * once and forward to them.
+ *
+ * Functions that build a string also have an overload writing into a
+ * `smallStr&`, which keeps short results out of the heap, and one taking a
+ * trailing `std::pmr::memory_resource*`, which returns a `smallStr` whose
+ * heap storage comes from that resource (e.g. a per-request arena).
  */
 namespace strTools {
+	/**
+	 * @brief Allocates a `uniqueStr` result of `n` characters.
+	 *
+	 * @param r The result to (re)allocate.
+	 * @param n The number of characters, excluding the terminator.
+	 * @return A writable pointer to the first character.
+	 */
+	static char* __resultBuffer(uniqueStr& r, const size_t n) {
+		// Every character is written by the caller, so the buffer is not zeroed.
+		r = std::make_unique_for_overwrite<char[]>(n + 1);
+		char* p = r.get();
+		p[n] = '\0';
+		return p;
+	}
+
+	/**
+	 * @brief Prepares a `smallStr` result of `n` characters.
+	 *
+	 * Inline storage (or the existing heap buffer) is reused when possible.
+	 *
+	 * @param r The result to prepare.
+	 * @param n The number of characters, excluding the terminator.
+	 * @return A writable pointer to the first character.
+	 */
+	static char* __resultBuffer(smallStr& r, const size_t n) {
+		return r.reset(n);
+	}
+
+	/**
+	 * @brief Joins several character ranges into a result string.
+	 *
+	 * Every range carries its own length, so the result is sized once and
+	 * filled with `memcpy` without measuring anything again.
+	 *
+	 * @tparam R The result type (`uniqueStr` or `smallStr`).
+	 * @param r The result to write into.
+	 * @param parts The ranges to copy, in order.
+	 */
+	template<class R>
+	static void __joinStr(R& r, std::initializer_list<string_view> parts) {
+		_STRSPAN("__joinStr");
+		size_t n = 0;
+		for( const auto& p : parts ) n += p.size();
+
+		if constexpr( std::is_same_v<R, smallStr> ) {
+			// A part may view `r` itself (e.g. `concatStr(r, r, "!")`), so
+			// build into a temporary instead of overwriting our own input.
+			const char* lo = r.data();
+			const char* hi = r.data() + r.size();
+			for( const auto& p : parts ) {
+				if( !p.empty() && p.data() < hi && lo < p.data() + p.size() ) {
+					smallStr tmp(r.memoryResource());
+					__joinStr(tmp, parts);
+					r = std::move(tmp);
+					return;
+				}
+			}
+		}
+
+		char* d = __resultBuffer(r, n);
+		for( const auto& p : parts ) {
+			if( p.empty() ) continue;
+			memcpy(d, p.data(), p.size());
+			d += p.size();
+		}
+	}
+
+	/**
+	 * @brief Joins several character ranges into a new unique_ptr<char[]>.
+	 *
+	 * @param parts The ranges to copy, in order.
+	 * @return A unique_ptr<char[]> containing the joined string.
+	 */
+	static uniqueStr __joinStr(std::initializer_list<string_view> parts) {
+		uniqueStr r;
+		__joinStr(r, parts);
+		return r;
+	}
+
+	/**
+	 * @brief Concatenates two character ranges into a new unique_ptr<char[]>.
+	 *
+	 * The result holds `s1.size() + s2.size()` characters followed by a null
+	 * terminator. Embedded NUL characters are copied as-is.
+	 *
+	 * @param s1 The first source range.
+	 * @param s2 The second source range.
+	 * @return A unique_ptr<char[]> containing the concatenated string.
+	 *
+	 * @note Example usage:
+	 * @code
+	 * std::string_view frame(buf, n); // not null-terminated
+	 * auto result = strTools::concatStr(frame, "\r\n");
+	 * @endcode
+	 */
+	uniqueStr concatStr(string_view s1, string_view s2) {
+		_STROP("concatStr", s1.size() + s2.size());
+		_STRLOGF("concatStr(string_view, string_view): {}, {}", s1.size(), s2.size());
+		return __joinStr({ s1, s2 });
+	}
+
+	/**
+	 * @brief Concatenates two character ranges into a `smallStr`.
+	 *
+	 * Results of up to `smallStr::inlineCapacity` characters need no heap
+	 * allocation. `r` may also be one of the inputs.
+	 *
+	 * @param r The result string.
+	 * @param s1 The first source range.
+	 * @param s2 The second source range.
+	 *
+	 * @note Example usage:
+	 * @code
+	 * smallStr key;
+	 * strTools::concatStr(key, "user:", "1234");
+	 * // key will contain "user:1234"
+	 * @endcode
+	 */
+	void concatStr(smallStr& r, string_view s1, string_view s2) {
+		_STROP("concatStr", s1.size() + s2.size());
+		_STRLOGF("concatStr(smallStr, string_view, string_view): {}, {}", s1.size(), s2.size());
+		__joinStr(r, { s1, s2 });
+	}
+
+	/**
+	 * @brief Concatenates two character ranges using a memory resource.
+	 *
+	 * @param s1 The first source range.
+	 * @param s2 The second source range.
+	 * @param mr The memory resource for results that don't fit inline.
+	 * @return A smallStr containing the concatenated string.
+	 *
+	 * @note Example usage:
+	 * @code
+	 * std::pmr::monotonic_buffer_resource arena;
+	 * auto result = strTools::concatStr("Hello, ", "World!", &arena);
+	 * // every arena-backed string is released together with `arena`
+	 * @endcode
+	 */
+	smallStr concatStr(string_view s1, string_view s2, std::pmr::memory_resource* mr) {
+		_STROP("concatStr", s1.size() + s2.size());
+		_STRLOGF("concatStr(string_view, string_view, memory_resource*): {}, {}", s1.size(), s2.size());
+		smallStr r(mr);
+		__joinStr(r, { s1, s2 });
+		return r;
+	}
+
 	/**
 	 * @brief Concatenates two C-strings into a new unique_ptr<char[]>.
 	 *
@@ -55,21 +224,71 @@ namespace strTools {
 	 * @endcode
 	 */
 	uniqueStr concatStr(const char* s1, const char* s2) noexcept {
-		_strLogger("concatStr(char*, char*)", to_string(*s1) + ", " + to_string(*s2));
-		// Calculate the length of the new concatenated string
-		auto lenS1 = strlen(s1);
-		auto lenS2 = strlen(s2);
-
-		// Allocate memory for the concatenated string
-		uniqueStr r = std::make_unique<char[]>(
-			static_cast<size_t>( lenS1 ) + lenS2 + 1
+		_STRLOGF("concatStr(char*, char*): {}, {}", static_cast<int>( *s1 ), static_cast<int>( *s2 ));
+		return concatStr(string_view(s1), string_view(s2));
+	}
+
+	/**
+	 * @brief Shared implementation of `subStr` for every result type.
+	 */
+	template<class R>
+	static void __subStr(R& r, string_view s, const uint64_t i, const uint64_t j) {
+		__StrUtilExtra.checkLogicErrors(
+			i >= s.size() || i + j > s.size(),
+			"The indices 'i' and 'j' must be non-negative and "
+			"the length must not exceed the length of the original string.",
+			_STRLOG_SITE_LIMITER()
 		);
-		// Copy the first string into the result
-		strcpy(r.get(), s1);
-		// Concatenate the second string
-		strcat(r.get(), s2);
+		__joinStr(r, { s.substr(i, j) });
+	}
 
-		_strLogger("concatStr", "returned: " + to_string( *r.get() ));
+	/**
+	 * @brief Extracts a substring from a character range.
+	 *
+	 * @param s The source range.
+	 * @param i Position of the first character to include (index 0 = first character).
+	 * @param j Number of characters to extract from i.
+	 * @return A unique_ptr<char[]> containing the extracted substring.
+	 * @throws std::runtime_error if indices are out of bounds.
+	 */
+	uniqueStr subStr(string_view s, const uint64_t i, const uint64_t j) {
+		_STROP("subStr", s.size());
+		_STRLOGF("subStr(string_view, uint64_t, uint64_t): {}, {}, {}", s.size(), i, j);
+		uniqueStr r;
+		__subStr(r, s, i, j);
+		return r;
+	}
+
+	/**
+	 * @brief Extracts a substring from a character range into a `smallStr`.
+	 *
+	 * @param r The result string. It may also be the source.
+	 * @param s The source range.
+	 * @param i Position of the first character to include (index 0 = first character).
+	 * @param j Number of characters to extract from i.
+	 * @throws std::runtime_error if indices are out of bounds.
+	 */
+	void subStr(smallStr& r, string_view s, const uint64_t i, const uint64_t j) {
+		_STROP("subStr", s.size());
+		_STRLOGF("subStr(smallStr, string_view, uint64_t, uint64_t): {}, {}, {}", s.size(), i, j);
+		__subStr(r, s, i, j);
+	}
+
+	/**
+	 * @brief Extracts a substring from a character range using a memory resource.
+	 *
+	 * @param s The source range.
+	 * @param i Position of the first character to include (index 0 = first character).
+	 * @param j Number of characters to extract from i.
+	 * @param mr The memory resource for results that don't fit inline.
+	 * @return A smallStr containing the extracted substring.
+	 * @throws std::runtime_error if indices are out of bounds.
+	 */
+	smallStr subStr(string_view s, const uint64_t i, const uint64_t j, std::pmr::memory_resource* mr) {
+		_STROP("subStr", s.size());
+		_STRLOGF("subStr(string_view, uint64_t, uint64_t, memory_resource*): {}, {}, {}", s.size(), i, j);
+		smallStr r(mr);
+		__subStr(r, s, i, j);
 		return r;
 	}
 
@@ -84,7 +303,7 @@ namespace strTools {
 	 * @param i Position of the first character to include (index 0 = first character).
 	 * @param j Number of characters to extract from i.
 	 * @return A unique_ptr<char[]> containing the extracted substring.
-	 * @throws std::out_of_range if indices are out of bounds.
+	 * @throws std::runtime_error if indices are out of bounds.
 	 *
 	 * @note Example usage:
 	 * @code
@@ -93,23 +312,99 @@ namespace strTools {
 	 * // sub will contain "World"
 	 * @endcode
 	 */
-	uniqueStr subStr(const char* s, const uint64_t i, uint64_t j) {
-		_strLogger("subStr(char*, char*)", to_string(*s) + ", " + to_string(i) + ", " + to_string(j));
-		auto sLen = strlen(s);
+	uniqueStr subStr(const char* s, const uint64_t i, const uint64_t j) {
+		_STRLOGF("subStr(char*, uint64_t, uint64_t): {}, {}, {}", static_cast<int>( *s ), i, j);
+		return subStr(string_view(s), i, j);
+	}
 
+	/**
+	 * @brief Extracts a substring from a slice without copying.
+	 *
+	 * Unlike the other overloads, nothing is allocated: the result is
+	 * another slice of the same parent buffer.
+	 *
+	 * @param s The source slice.
+	 * @param i Position of the first character to include (index 0 = first character).
+	 * @param j Number of characters to extract from i.
+	 * @return A strSlice viewing the extracted substring.
+	 * @throws std::runtime_error if indices are out of bounds.
+	 *
+	 * @note Example usage:
+	 * @code
+	 * strSlice s(strUtil::makeSharedStr("Hello, World!"));
+	 * auto sub = strTools::subStr(s, 7, 5);
+	 * // sub will view "World"
+	 * @endcode
+	 */
+	strSlice subStr(const strSlice& s, const uint64_t i, const uint64_t j) {
+		_STROP("subStr", s.size());
+		_STRLOGF("subStr(strSlice, uint64_t, uint64_t): {}, {}, {}", s.size(), i, j);
+		return s.slice(i, j);
+	}
+
+	/**
+	 * @brief Shared implementation of `insertStr` for every result type.
+	 */
+	template<class R>
+	static void __insertStr(R& r, string_view s1, string_view s2, const uint64_t i) {
 		__StrUtilExtra.checkLogicErrors(
-			i >= sLen || i + j > sLen,
-			"The indices 'i' and 'j' must be non-negative and "
-			"the length must not exceed the length of the original string."
+			i < 1 || i > s1.size() + 1,
+			"The value of 'i' must be in the range of 1 to the length of s1 + 1",
+			_STRLOG_SITE_LIMITER()
 		);
+		__joinStr(r, { s1.substr(0, i - 1), s2, s1.substr(i - 1) });
+	}
 
-		uniqueStr r = std::make_unique<char[]>(
-			static_cast<uint64_t>( j ) + 1
-		);
-		strncpy(r.get(), s + i, j);
-		r[j] = '\0';
+	/**
+	 * @brief Inserts one character range into another at the specified position.
+	 *
+	 * The result is built with a single allocation; no intermediate
+	 * substrings are created.
+	 *
+	 * @param s1 The destination range.
+	 * @param s2 The source range to be inserted.
+	 * @param i The position (1-based) at which to insert s2 into s1.
+	 * @return A unique_ptr<char[]> containing the resulting string.
+	 * @throws std::runtime_error if the position is out of bounds.
+	 */
+	uniqueStr insertStr(string_view s1, string_view s2, const uint64_t i) {
+		_STROP("insertStr", s1.size() + s2.size());
+		_STRLOGF("insertStr(string_view, string_view, uint64_t): {}, {}, {}", s1.size(), s2.size(), i);
+		uniqueStr r;
+		__insertStr(r, s1, s2, i);
+		return r;
+	}
+
+	/**
+	 * @brief Inserts one character range into another, writing into a `smallStr`.
+	 *
+	 * @param r The result string. It may also be one of the inputs.
+	 * @param s1 The destination range.
+	 * @param s2 The source range to be inserted.
+	 * @param i The position (1-based) at which to insert s2 into s1.
+	 * @throws std::runtime_error if the position is out of bounds.
+	 */
+	void insertStr(smallStr& r, string_view s1, string_view s2, const uint64_t i) {
+		_STROP("insertStr", s1.size() + s2.size());
+		_STRLOGF("insertStr(smallStr, string_view, string_view, uint64_t): {}, {}, {}", s1.size(), s2.size(), i);
+		__insertStr(r, s1, s2, i);
+	}
 
-		_strLogger("subStr", "returned: " + to_string(*r.get()));
+	/**
+	 * @brief Inserts one character range into another using a memory resource.
+	 *
+	 * @param s1 The destination range.
+	 * @param s2 The source range to be inserted.
+	 * @param i The position (1-based) at which to insert s2 into s1.
+	 * @param mr The memory resource for results that don't fit inline.
+	 * @return A smallStr containing the resulting string.
+	 * @throws std::runtime_error if the position is out of bounds.
+	 */
+	smallStr insertStr(string_view s1, string_view s2, const uint64_t i, std::pmr::memory_resource* mr) {
+		_STROP("insertStr", s1.size() + s2.size());
+		_STRLOGF("insertStr(string_view, string_view, uint64_t, memory_resource*): {}, {}, {}", s1.size(), s2.size(), i);
+		smallStr r(mr);
+		__insertStr(r, s1, s2, i);
 		return r;
 	}
 
@@ -122,9 +417,9 @@ namespace strTools {
 	 *
 	 * @param s1 The destination C-string.
 	 * @param s2 The source C-string to be inserted.
-	 * @param i The position at which to insert s2 into s1.
+	 * @param i The position (1-based) at which to insert s2 into s1.
 	 * @return A unique_ptr<char[]> containing the resulting string.
-	 * @throws std::out_of_range if the position is out of bounds.
+	 * @throws std::runtime_error if the position is out of bounds.
 	 *
 	 * @note Example usage:
 	 * @code
@@ -135,18 +430,79 @@ namespace strTools {
 	 * @endcode
 	 */
 	uniqueStr insertStr(const char* s1, const char* s2, const uint64_t i) {
-		_strLogger("insertStr(char*, char*, uint64_t)", to_string(*s1) + ", " + to_string(*s2) + ", " + to_string(i));
+		_STRLOGF("insertStr(char*, char*, uint64_t): {}, {}, {}", static_cast<int>( *s1 ), static_cast<int>( *s2 ), i);
+		return insertStr(string_view(s1), string_view(s2), i);
+	}
+
+	/**
+	 * @brief Shared implementation of `delSubStr` for every result type.
+	 */
+	template<class R>
+	static void __delSubStr(R& r, string_view s, const uint64_t i, const uint64_t j) {
+		__StrUtilExtra.checkLogicErrors(
+			i < 1 || i > s.size(),
+			"Position of `i` must be between 1 and the length of the string.",
+			_STRLOG_SITE_LIMITER()
+		);
 		__StrUtilExtra.checkLogicErrors(
-			1 <= i || i <= strlen(s1) + 1,
-			"The value of 'i' must be in the range of 1 to the length of s1 + 1"
+			j > s.size() - ( i - 1 ),
+			"Position i+j-1 must be between 0 and the length of the string.",
+			_STRLOG_SITE_LIMITER()
 		);
+		__joinStr(r, { s.substr(0, i - 1), s.substr(i - 1 + j) });
+	}
 
-		auto p1 = subStr(s1, 0, i - 1);
-		auto p2 = concatStr(p1.get(), s2);
-		auto p3 = subStr(s1, i - 1, strlen(s1) - ( i - 1 ));
+	/**
+	 * @brief Removes a substring from a character range.
+	 *
+	 * The result is built with a single allocation; no intermediate
+	 * substrings are created.
+	 *
+	 * @param s The source range.
+	 * @param i The starting position (1-based) of the substring to be removed.
+	 * @param j The length of the substring to be removed.
+	 * @return A unique_ptr<char[]> containing the resulting string.
+	 * @throws std::runtime_error if indices are out of bounds.
+	 */
+	uniqueStr delSubStr(string_view s, const uint64_t i, const uint64_t j) {
+		_STROP("delSubStr", s.size());
+		_STRLOGF("delSubStr(string_view, uint64_t, uint64_t): {}, {}, {}", s.size(), i, j);
+		uniqueStr r;
+		__delSubStr(r, s, i, j);
+		return r;
+	}
 
-		_strLogger("insertStr", "returned: " + to_string(*p2.get()) + to_string(*p3.get()));
-		return concatStr(p2.get(), p3.get());
+	/**
+	 * @brief Removes a substring from a character range, writing into a `smallStr`.
+	 *
+	 * @param r The result string. It may also be the source.
+	 * @param s The source range.
+	 * @param i The starting position (1-based) of the substring to be removed.
+	 * @param j The length of the substring to be removed.
+	 * @throws std::runtime_error if indices are out of bounds.
+	 */
+	void delSubStr(smallStr& r, string_view s, const uint64_t i, const uint64_t j) {
+		_STROP("delSubStr", s.size());
+		_STRLOGF("delSubStr(smallStr, string_view, uint64_t, uint64_t): {}, {}, {}", s.size(), i, j);
+		__delSubStr(r, s, i, j);
+	}
+
+	/**
+	 * @brief Removes a substring from a character range using a memory resource.
+	 *
+	 * @param s The source range.
+	 * @param i The starting position (1-based) of the substring to be removed.
+	 * @param j The length of the substring to be removed.
+	 * @param mr The memory resource for results that don't fit inline.
+	 * @return A smallStr containing the resulting string.
+	 * @throws std::runtime_error if indices are out of bounds.
+	 */
+	smallStr delSubStr(string_view s, const uint64_t i, const uint64_t j, std::pmr::memory_resource* mr) {
+		_STROP("delSubStr", s.size());
+		_STRLOGF("delSubStr(string_view, uint64_t, uint64_t, memory_resource*): {}, {}, {}", s.size(), i, j);
+		smallStr r(mr);
+		__delSubStr(r, s, i, j);
+		return r;
 	}
 
 	/**
@@ -157,46 +513,71 @@ namespace strTools {
 	 * `uniqueStr`.
 	 *
 	 * @param s The source C-string.
-	 * @param i The starting position of the substring to be removed.
+	 * @param i The starting position (1-based) of the substring to be removed.
 	 * @param j The length of the substring to be removed.
 	 * @return A unique_ptr<char[]> containing the resulting string.
-	 * @throws std::out_of_range if indices are out of bounds.
+	 * @throws std::runtime_error if indices are out of bounds.
 	 *
 	 * @note Example usage:
 	 * @code
 	 * const char* myString = "Hello, World!";
-	 * auto result = strTools::delSubStr(myString, 7, 6);
+	 * auto result = strTools::delSubStr(myString, 8, 5);
 	 * // result will contain "Hello, !"
 	 * @endcode
 	 */
 	uniqueStr delSubStr(const char* s, const uint64_t i, const uint64_t j) {
-		_strLogger("delSubStr(char*, uint64_t, uint64_t)", to_string(*s) + ", " + to_string(i) + ", " + to_string(j));
-		__StrUtilExtra.checkLogicErrors(
-			0 <= i && i < strlen(s),
-			"Position of `i` must be between 0 and the length of the string."
-		);
-		__StrUtilExtra.checkLogicErrors(
-			0 <= j && j < strlen(s),
-			"Length `j` must be between 0 and the length of the string."
-		);
-		__StrUtilExtra.checkLogicErrors(
-			0 <= i + j - 1 && i + j - 1 < strlen(s),
-			"Position i+j-1 must be between 0 and the length of the string."
-		);
+		_STRLOGF("delSubStr(char*, uint64_t, uint64_t): {}, {}, {}", static_cast<int>( *s ), i, j);
+		return delSubStr(string_view(s), i, j);
+	}
 
-		auto p1 = subStr(s, 0, i - 1);
-		auto p2 = subStr(s, i + j - 1, strlen(s) - ( i + j - 1 ));
+	/**
+	 * @brief Finds the first occurrence of a character range within another.
+	 *
+	 * The search is case-insensitive for ASCII only: `A`-`Z` are folded to
+	 * `a`-`z` while comparing (see `__StrSimd::foldWord`/`foldMismatch`), so
+	 * no lowercased copies are allocated. Bytes above 0x7F must match
+	 * exactly, and the C locale is not consulted; use `strTools::findSubStrUtf8` for
+	 * case-insensitive search in non-ASCII text.
+	 *
+	 * @param s The source range.
+	 * @param find The range to find.
+	 * @return The index of the first occurrence of the substring, or INT64_MAX if not found.
+	 */
+	int64_t findSubStr(string_view s, string_view find) {
+		_STROP("findSubStr", s.size());
+		_STRLOGF("findSubStr(string_view, string_view): {}, {}", s.size(), find.size());
+		// The original string is empty or,
+		// If `find` is longer than `s`, it can't be found.
+		if( s.empty() || find.size() > s.size() ) {
+			_STRLOGF_LIMIT_AT(__StrToolsLogLvl::ERROR, "findSubStr: returned: {}", INT64_MAX);
+			return INT64_MAX;
+		}
+
+		if( find.empty() ) {
+			_STRLOGF_LIMIT_AT(__StrToolsLogLvl::WARNING, "findSubStr: returned: {}", 0);
+			return 0; // Empty substring is always found at the start.
+		}
+
+		// Check the first character, then let the folded compare run over the rest.
+		const uint64_t first = __StrSimd::foldWord((unsigned char) find[0]);
+		for( uint64_t i = 0; i <= s.size() - find.size(); ++i ) {
+			if( __StrSimd::foldWord((unsigned char) s[i]) != first ) continue;
+			if( __StrSimd::foldMismatch(s.data() + i + 1, find.data() + 1, find.size() - 1) == find.size() - 1 ) {
+				_STRLOGF("findSubStr: returned: {}", i);
+				return static_cast<int64_t>( i );
+			}
+		}
 
-		_strLogger("delSubStr", "returned: " + to_string(*p1.get()) + to_string(*p2.get()));
-		return concatStr(p1.get(), p2.get());
+		_STRLOGF_LIMIT_AT(__StrToolsLogLvl::ERROR, "findSubStr: returned: {}", INT64_MAX);
+		return INT64_MAX;
 	}
 
 	/**
 	 * @brief Finds the first occurrence of a substring within a string.
 	 *
 	 * This function searches for the first occurrence of the substring `find`
-	 * within the source string `s`. It returns the index of the first occurrence,
-	 * or `INT64_MAX` if the substring is not found.
+	 * within the source string `s`, ignoring ASCII case. It returns the index of the
+	 * first occurrence, or `INT64_MAX` if the substring is not found.
 	 *
 	 * @param s The source C-string.
 	 * @param find The substring to find.
@@ -210,43 +591,69 @@ namespace strTools {
 	 * @endcode
 	 */
 	int64_t findSubStr(const char* s, const char* find) {
-		_strLogger("findSubStr(char*, char*)", to_string(*s) + ", " + to_string(*find));
-		auto lenS = strlen(s);
-		auto lenFind = strlen(find);
-
-		// Fix the strings because we don't really care about specifics.
-		const auto& lowS = strUtil::toLower(s);
-		const auto& lowFind = strUtil::toLower(find);
+		_STRLOGF("findSubStr(char*, char*): {}, {}", static_cast<int>( *s ), static_cast<int>( *find ));
+		return findSubStr(string_view(s), string_view(find));
+	}
 
-		// The original string is empty or,
-		// If `find` is longer than `s`, it can't be found.
-		if( lenS == 0 || lenFind > lenS ) {
-			_strLogger("findSubStr", "returned: " + to_string(INT64_MAX), __StrToolsLogLvl::ERROR);
-			return INT64_MAX;
-		}
+	/**
+	 * @brief Shared implementation of `replaceStr` for every result type.
+	 */
+	template<class R>
+	static void __replaceStr(R& r, string_view s, string_view sub1, string_view sub2) {
+		const auto pos = s.find(sub1);
+		_STRLOGF("replaceStr: found at: {}", pos);
+		if( pos == string_view::npos ) return __joinStr(r, { s });
+		__joinStr(r, { s.substr(0, pos), sub2, s.substr(pos + sub1.size()) });
+	}
 
-		if( lenFind == 0 ) {
-			_strLogger("findSubStr", "returned: " + to_string(0), __StrToolsLogLvl::WARNING);
-			return 0; // Empty substring is always found at the start.
-		}
+	/**
+	 * @brief Replaces the first occurrence of a character range with another.
+	 *
+	 * Matching is case-sensitive. If `sub1` is not found, the source is copied
+	 * unchanged.
+	 *
+	 * @param s The source range.
+	 * @param sub1 The substring to be replaced.
+	 * @param sub2 The substring to replace with.
+	 * @return A unique_ptr<char[]> containing the resulting string.
+	 */
+	uniqueStr replaceStr(string_view s, string_view sub1, string_view sub2) {
+		_STROP("replaceStr", s.size());
+		_STRLOGF("replaceStr(string_view, string_view, string_view): {}, {}, {}", s.size(), sub1.size(), sub2.size());
+		uniqueStr r;
+		__replaceStr(r, s, sub1, sub2);
+		return r;
+	}
 
-		// Get the index using bubble sorting (kind of)
-		for( uint64_t i = 0; i <= lenS - lenFind; ++i ) {
-			bool found = true;
-			for( uint64_t j = 0; j < lenFind; ++j ) {
-				if( lowS.get()[i + j] != lowFind.get()[j] ) {
-					found = false;
-					break;
-				}
-			}
-			if( found ) {
-				_strLogger("findSubStr", "returned: " + to_string(i));
-				return static_cast<uint64_t>( i );
-			}
-		}
+	/**
+	 * @brief Replaces the first occurrence of a character range, writing into a `smallStr`.
+	 *
+	 * @param r The result string. It may also be one of the inputs.
+	 * @param s The source range.
+	 * @param sub1 The substring to be replaced.
+	 * @param sub2 The substring to replace with.
+	 */
+	void replaceStr(smallStr& r, string_view s, string_view sub1, string_view sub2) {
+		_STROP("replaceStr", s.size());
+		_STRLOGF("replaceStr(smallStr, string_view, string_view, string_view): {}, {}, {}", s.size(), sub1.size(), sub2.size());
+		__replaceStr(r, s, sub1, sub2);
+	}
 
-		_strLogger("findSubStr", "returned: " + to_string(INT64_MAX), __StrToolsLogLvl::ERROR);
-		return INT64_MAX;
+	/**
+	 * @brief Replaces the first occurrence of a character range using a memory resource.
+	 *
+	 * @param s The source range.
+	 * @param sub1 The substring to be replaced.
+	 * @param sub2 The substring to replace with.
+	 * @param mr The memory resource for results that don't fit inline.
+	 * @return A smallStr containing the resulting string.
+	 */
+	smallStr replaceStr(string_view s, string_view sub1, string_view sub2, std::pmr::memory_resource* mr) {
+		_STROP("replaceStr", s.size());
+		_STRLOGF("replaceStr(string_view, string_view, string_view, memory_resource*): {}, {}, {}", s.size(), sub1.size(), sub2.size());
+		smallStr r(mr);
+		__replaceStr(r, s, sub1, sub2);
+		return r;
 	}
 
 	/**
@@ -271,46 +678,72 @@ namespace strTools {
 	 * @endcode
 	 */
 	uniqueStr replaceStr(const char* s, const char* sub1, const char* sub2) {
-		_strLogger("replaceStr(char*, char*, char*)", to_string(*s) + ", " + to_string(*sub1) + ", " + to_string(*sub2));
-		// Returns the sub string index position.
-		auto getSubStr = [&](const char* s, const char* sub) {
-			_strLogger("getSubStr(char*, char*)", to_string(*s) + ", " + to_string(*sub1));
-			const char* pos = strstr(s, sub);
-			if( pos ) return (int64_t) pos - (int64_t) s; 
-			else return (int64_t) 0;
-			};
-
-		int64_t pos = getSubStr(s, sub1);
-		_strLogger("getSubStr", "returned: " + to_string(pos));
-		// Fix the index of `pos` JUST IN CASE.
-		// If the index is out of bounds this will simply return 0 (the first position).
-		if( pos > INT64_MAX ) {
-			pos = 0ull;
-		}
-
-		auto lenS = strlen(s);
-		auto lenSub1 = strlen(sub1);
-		auto lenSub2 = strlen(sub2);
-
-		// Calculate the length of the new string
-		auto newLen = lenS - lenSub1 + lenSub2;
-
-		// Allocate memory for the new string
-		uniqueStr r = std::make_unique<char[]>(
-			static_cast<size_t>( newLen ) + 1
-		);
-
-		// Copy the part before sub1
-		strncpy(r.get(), s, pos);
-		r[pos] = '\0';
+		_STRLOGF("replaceStr(char*, char*, char*): {}, {}, {}", static_cast<int>( *s ), static_cast<int>( *sub1 ), static_cast<int>( *sub2 ));
+		return replaceStr(string_view(s), string_view(sub1), string_view(sub2));
+	}
 
-		// Append sub2
-		strcat(r.get(), sub2);
+	/**
+	 * @brief Calls `token(offset, length)` for every token of `s`, in order.
+	 *
+	 * Delimiters are found with `string_view::find` (a `memchr` scan).
+	 */
+	template<class F>
+	static void __splitStr(string_view s, const char delim, F&& token) {
+		if( s.empty() ) return;
+		size_t start = 0;
+		while( true ) {
+			const auto pos = s.find(delim, start);
+			if( pos == string_view::npos ) return token(start, s.size() - start);
+			token(start, pos - start);
+			start = pos + 1;
+		}
+	}
 
-		// Append the part after sub1
-		strcat(r.get(), s + pos + lenSub1);
+	/**
+	 * @brief Splits a character range into tokens without copying them.
+	 *
+	 * Every token views the source range; only the returned vector itself is
+	 * allocated. Empty tokens between consecutive delimiters are kept.
+	 *
+	 * @param s The source range.
+	 * @param delim The delimiter character.
+	 * @return A vector of views, one per token.
+	 */
+	std::vector<string_view> splitStr(string_view s, const char delim) {
+		_STROP("splitStr", s.size());
+		_STRLOGF("splitStr(string_view, char): {}, {}", s.size(), static_cast<int>( delim ));
+		std::vector<string_view> r;
+		__splitStr(s, delim, [&](const size_t at, const size_t n) { r.push_back(s.substr(at, n)); });
+		return r;
+	}
 
-		_strLogger("replaceStr", "returned: " + to_string(*r.get()));
+	/**
+	 * @brief Splits a slice into tokens without copying them.
+	 *
+	 * Every token is a slice of the same parent buffer, so the tokens stay
+	 * valid after the original `sharedStr` is released. Only the returned
+	 * vector itself is allocated. Empty tokens between consecutive delimiters
+	 * are kept.
+	 *
+	 * @param s The source slice.
+	 * @param delim The delimiter character.
+	 * @return A vector of slices, one per token.
+	 *
+	 * @note Example usage:
+	 * @code
+	 * strSlice s(strUtil::makeSharedStr("a,b,,c"));
+	 * auto tokens = strTools::splitStr(s, ',');
+	 * // tokens will view "a", "b", "" and "c"
+	 * @endcode
+	 */
+	std::vector<strSlice> splitStr(const strSlice& s, const char delim) {
+		_STROP("splitStr", s.size());
+		_STRLOGF("splitStr(strSlice, char): {}, {}", s.size(), static_cast<int>( delim ));
+		std::vector<strSlice> r;
+		// Same scan as the string_view overload; each token becomes a slice at its offset.
+		__splitStr(s.view(), delim, [&](const size_t at, const size_t n) {
+			r.push_back(n ? s.slice(at, n) : strSlice());
+		});
 		return r;
 	}
 }
@@ -0,0 +1,279 @@
+/**
+ * @file strtrace.hh
+ * @author Ian Hylton
+ * @brief Optional span tracing of strTools calls, exported as Chrome trace JSON.
+ * @version 1.0.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) zperk 2024
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+/**
+ * @class __StrTracer
+ * @brief Records timed spans per thread and writes them as trace-event JSON.
+ *
+ * Each thread appends finished spans to its own buffer, guarded by a lock
+ * only the exporter ever contends for. Spans are "complete" events, so
+ * Perfetto (ui.perfetto.dev) and chrome://tracing nest them by time: an
+ * operation's span shows the `__joinStr` copy it made inside it, and a
+ * user's `_STRSPAN` shows every strTools call made within it.
+ *
+ * Spans come from `_STROP` in every strTools operation and from `_STRSPAN`
+ * in user code, when built with `STRTOOLS_TRACE` defined. Recording is off
+ * until `start()` is called.
+ *
+ * @note Example usage:
+ * @code
+ * // g++ -DSTRTOOLS_TRACE ...
+ * __StrTracer::start();
+ * runWorkload();
+ * __StrTracer::stop();
+ * std::ofstream out("strtools.trace.json");
+ * __StrTracer::writeJson(out); // open it in ui.perfetto.dev
+ * @endcode
+ */
+class __StrTracer {
+private:
+	using Clock = std::chrono::steady_clock;
+
+	struct Event {
+		const char* name;
+		int64_t startNs;
+		int64_t durationNs;
+		uint64_t bytes;
+	};
+
+	struct ThreadBuffer;
+
+	struct Registry {
+		std::mutex lock;
+		std::vector<ThreadBuffer*> threads;
+		/// @brief Events of threads that have exited, with their thread IDs.
+		std::vector<std::pair<uint32_t, Event>> retired;
+		uint32_t nextTid = 1;
+	};
+
+	static Registry& registry() {
+		static Registry r;
+		return r;
+	}
+
+	static std::atomic<bool>& enabled() {
+		static std::atomic<bool> on { false };
+		return on;
+	}
+
+	static std::atomic<int64_t>& epoch() {
+		static std::atomic<int64_t> t { 0 };
+		return t;
+	}
+
+	static std::atomic<size_t>& capacity() {
+		static std::atomic<size_t> n { 1 << 20 };
+		return n;
+	}
+
+	static std::atomic<uint64_t>& droppedEvents() {
+		static std::atomic<uint64_t> n { 0 };
+		return n;
+	}
+
+	/// @brief One thread's finished spans.
+	struct ThreadBuffer {
+		std::mutex lock;
+		uint32_t tid;
+		std::vector<Event> events;
+
+		ThreadBuffer() {
+			Registry& r = registry();
+			std::lock_guard<std::mutex> guard(r.lock);
+			tid = r.nextTid++;
+			r.threads.push_back(this);
+		}
+
+		~ThreadBuffer() {
+			Registry& r = registry();
+			std::lock_guard<std::mutex> guard(r.lock);
+			for( const Event& e : events ) r.retired.emplace_back(tid, e);
+			for( size_t i = 0; i < r.threads.size(); ++i ) {
+				if( r.threads[i] == this ) {
+					r.threads.erase(r.threads.begin() + static_cast<std::ptrdiff_t>( i ));
+					break;
+				}
+			}
+		}
+	};
+
+	static ThreadBuffer& local() {
+		static thread_local ThreadBuffer buffer;
+		return buffer;
+	}
+
+	/**
+	 * @brief Writes nanoseconds as microseconds with three decimals.
+	 */
+	static void writeMicros(std::ostream& out, int64_t ns) {
+		if( ns < 0 ) {
+			out << '-';
+			ns = -ns;
+		}
+		const int64_t frac = ns % 1000;
+		out << ns / 1000 << '.' << static_cast<char>( '0' + frac / 100 )
+			<< static_cast<char>( '0' + frac / 10 % 10 ) << static_cast<char>( '0' + frac % 10 );
+	}
+
+	static void writeEvent(std::ostream& out, const uint32_t tid, const Event& e, bool& first) {
+		out << ( first ? "\n" : ",\n" ) << "{\"name\":\"" << e.name << "\",\"cat\":\"strtools\",\"ph\":\"X\",\"pid\":1,\"tid\":" << tid
+			<< ",\"ts\":";
+		writeMicros(out, e.startNs - epoch().load(std::memory_order_relaxed));
+		out << ",\"dur\":";
+		writeMicros(out, e.durationNs);
+		if( e.bytes != UINT64_MAX ) out << ",\"args\":{\"bytes\":" << e.bytes << "}";
+		out << "}";
+		first = false;
+	}
+
+public:
+	/**
+	 * @brief Reads the trace clock in nanoseconds.
+	 */
+	static int64_t now() noexcept {
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+	}
+
+	/**
+	 * @brief Checks whether spans are being recorded.
+	 */
+	static bool isEnabled() noexcept {
+		return enabled().load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Discards earlier spans and starts recording.
+	 *
+	 * @param eventsPerThread The most spans kept per thread; later ones are
+	 * counted in `dropped()` instead.
+	 */
+	static void start(const size_t eventsPerThread = 1 << 20) {
+		Registry& r = registry();
+		{
+			std::lock_guard<std::mutex> guard(r.lock);
+			r.retired.clear();
+			for( ThreadBuffer* t : r.threads ) {
+				std::lock_guard<std::mutex> buffer(t->lock);
+				t->events.clear();
+			}
+		}
+		capacity().store(eventsPerThread, std::memory_order_relaxed);
+		droppedEvents().store(0, std::memory_order_relaxed);
+		epoch().store(now(), std::memory_order_relaxed);
+		enabled().store(true, std::memory_order_release);
+	}
+
+	/**
+	 * @brief Stops recording; the recorded spans are kept for `writeJson`.
+	 */
+	static void stop() noexcept {
+		enabled().store(false, std::memory_order_release);
+	}
+
+	/**
+	 * @brief Gets the number of spans discarded because a buffer was full.
+	 */
+	static uint64_t dropped() noexcept {
+		return droppedEvents().load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Adds one finished span to the calling thread's buffer.
+	 *
+	 * @param name A string with static storage (e.g. a literal).
+	 * @param startNs The start, from `now()`.
+	 * @param durationNs How long the span lasted.
+	 * @param bytes The bytes processed, or `UINT64_MAX` for none.
+	 */
+	static void record(const char* name, const int64_t startNs, const int64_t durationNs, const uint64_t bytes) {
+		ThreadBuffer& t = local();
+		std::lock_guard<std::mutex> guard(t.lock);
+		if( t.events.size() >= capacity().load(std::memory_order_relaxed) ) {
+			droppedEvents().fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		t.events.push_back(Event { name, startNs, durationNs, bytes });
+	}
+
+	/**
+	 * @brief Writes every recorded span as Chrome trace-event JSON.
+	 *
+	 * Timestamps are in microseconds since `start()`.
+	 */
+	static void writeJson(std::ostream& out) {
+		Registry& r = registry();
+		std::lock_guard<std::mutex> guard(r.lock);
+		out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+		bool first = true;
+		for( const auto& [tid, e] : r.retired ) writeEvent(out, tid, e, first);
+		for( ThreadBuffer* t : r.threads ) {
+			std::lock_guard<std::mutex> buffer(t->lock);
+			for( const Event& e : t->events ) writeEvent(out, t->tid, e, first);
+		}
+		out << "\n]}\n";
+	}
+};
+
+/**
+ * @class __StrTraceSpan
+ * @brief Records the enclosing scope as a span while tracing is enabled.
+ */
+class __StrTraceSpan {
+private:
+	const char* name;
+	uint64_t bytes;
+	int64_t start;
+
+public:
+	explicit __StrTraceSpan(const char* name, const uint64_t bytes = UINT64_MAX) noexcept
+		: name(name), bytes(bytes), start(__StrTracer::isEnabled() ? __StrTracer::now() : 0) {}
+
+	~__StrTraceSpan() {
+		if( start ) __StrTracer::record(name, start, __StrTracer::now() - start, bytes);
+	}
+
+	__StrTraceSpan(const __StrTraceSpan&) = delete;
+	__StrTraceSpan& operator=(const __StrTraceSpan&) = delete;
+};
+
+/**
+ * @brief Traces the rest of the enclosing scope as a span named `name`.
+ *
+ * `name` must be a string literal. Without `STRTOOLS_TRACE` the macro
+ * compiles to nothing.
+ *
+ * @note Example usage:
+ * @code
+ * void handleRequest() {
+ *     _STRSPAN("handleRequest");
+ *     ... // strTools calls show up nested inside this span
+ * }
+ * @endcode
+ */
+#ifdef STRTOOLS_TRACE
+#define _STRSPAN(name) const __StrTraceSpan __strTraceSpan(name)
+#define __STRSPAN_BYTES(name, bytes) const __StrTraceSpan __strTraceSpan(name, static_cast<uint64_t>( bytes ))
+#else
+#define _STRSPAN(name) static_cast<void>( 0 )
+#define __STRSPAN_BYTES(name, bytes) static_cast<void>( 0 )
+#endif
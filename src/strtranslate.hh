@@ -0,0 +1,236 @@
+/**
+ * @file strtranslate.hh
+ * @author Ian Hylton
+ * @brief Byte translation (tr-style) with a vectorized lookup.
+ * @version 1.0.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) zperk 2024
+ *
+ */
+
+#pragma once
+
+#include "strlogger.hh"
+#include "strprofile.hh"
+#include "strsimd.hh"
+#include "strsmall.hh"
+#include "strutil.hh"
+#include "strutilhelper.hh"
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+
+using std::string_view, std::to_string;
+
+/**
+ * @class strTranslator
+ * @brief A compiled byte mapping with an optional delete set, like `tr`.
+ *
+ * `__StrUtilHelper::toSomething` calls a function for every character. A
+ * translator instead builds its 256-entry table once and then applies it
+ * 16 or 32 bytes at a time with `pshufb` lookups (see `__StrSimd::translate`).
+ * Each 16-byte row of the table that is not the identity costs one lookup
+ * per block, so sparse mappings (ROT13, a few replaced separators) are much
+ * cheaper than dense ones; a delete set of any size costs three lookups plus
+ * a shuffle that squeezes out the deleted bytes.
+ *
+ * A new translator maps every byte to itself and deletes nothing. The
+ * delete set is tested on the input byte, before mapping, so a byte that is
+ * both mapped and deleted is deleted.
+ *
+ * @note Example usage:
+ * @code
+ * strTranslator t;
+ * t.map("\t\r", "  ").remove("\x01\x02\x7F");
+ * auto clean = t.translate(rawLine);   // new buffer
+ * size_t n = t.apply(buf, len);        // in place, returns the new length
+ * @endcode
+ */
+class strTranslator {
+private:
+	__StrSimd::ByteTable table;
+
+	void set(const unsigned char from, const unsigned char to) noexcept {
+		table.map[from >> 4][from & 0x0F] = to;
+	}
+
+	void drop(const unsigned char c) noexcept {
+		table.drop[c >> 4][c & 0x0F] = 0xFF;
+	}
+
+public:
+	/**
+	 * @brief Constructs the identity mapping with an empty delete set.
+	 */
+	strTranslator() noexcept {
+		for( int c = 0; c < 256; ++c ) set(static_cast<unsigned char>( c ), static_cast<unsigned char>( c ));
+		memset(table.drop, 0, sizeof(table.drop));
+		table.finish();
+	}
+
+	/**
+	 * @brief Builds a translator from a per-character function.
+	 *
+	 * The function is called once per byte value, not once per character
+	 * of the input.
+	 *
+	 * @param f The mapping function (e.g. `tolower`).
+	 * @return The compiled translator.
+	 */
+	static strTranslator fromFunction(int ( *f )( int )) {
+		strTranslator t;
+		for( int c = 0; c < 256; ++c ) t.set(static_cast<unsigned char>( c ), static_cast<unsigned char>( f(c) ));
+		t.table.finish();
+		return t;
+	}
+
+	/**
+	 * @brief Maps one byte to another.
+	 *
+	 * @note Has no effect on a byte in the delete set: deletion wins.
+	 */
+	strTranslator& map(const char from, const char to) noexcept {
+		set((unsigned char) from, (unsigned char) to);
+		table.finish();
+		return *this;
+	}
+
+	/**
+	 * @brief Maps each byte of `from` to the byte at the same position in `to`.
+	 *
+	 * As with `tr`, when `to` is shorter its last byte is repeated. Bytes of
+	 * `from` that are also in the delete set are still deleted.
+	 *
+	 * @param from The bytes to replace.
+	 * @param to The replacements.
+	 * @throws std::runtime_error if `to` is empty while `from` is not.
+	 */
+	strTranslator& map(string_view from, string_view to) {
+		__StrUtilExtra.checkLogicErrors(
+			!from.empty() && to.empty(),
+			"The replacement set must not be empty.",
+			_STRLOG_SITE_LIMITER()
+		);
+		for( size_t i = 0; i < from.size(); ++i ) {
+			set((unsigned char) from[i], (unsigned char) to[i < to.size() ? i : to.size() - 1]);
+		}
+		table.finish();
+		return *this;
+	}
+
+	/**
+	 * @brief Adds every byte of `chars` to the delete set.
+	 *
+	 * @note The set applies to input bytes and wins over `map`: a mapped
+	 * byte listed here is deleted, not replaced.
+	 */
+	strTranslator& remove(string_view chars) noexcept {
+		for( const char c : chars ) drop((unsigned char) c);
+		table.finish();
+		return *this;
+	}
+
+	/**
+	 * @brief Adds every byte for which `pred` is true to the delete set.
+	 *
+	 * Like `remove`, this wins over `map`: `iscntrl` also matches '\t' and
+	 * '\r', so those are deleted even if they were mapped to spaces.
+	 *
+	 * @param pred A classifier such as `iscntrl`.
+	 */
+	strTranslator& removeIf(int ( *pred )( int )) {
+		for( int c = 0; c < 256; ++c ) {
+			if( pred(c) ) drop(static_cast<unsigned char>( c ));
+		}
+		table.finish();
+		return *this;
+	}
+
+	/**
+	 * @brief Gets the byte that `c` maps to (ignoring the delete set).
+	 */
+	char lookup(const char c) const noexcept {
+		const unsigned char u = (unsigned char) c;
+		return static_cast<char>( table.map[u >> 4][u & 0x0F] );
+	}
+
+	/**
+	 * @brief Checks whether `c` is in the delete set.
+	 */
+	bool removes(const char c) const noexcept {
+		const unsigned char u = (unsigned char) c;
+		return table.drop[u >> 4][u & 0x0F] != 0;
+	}
+
+	/**
+	 * @brief Translates a buffer in place.
+	 *
+	 * Deleted bytes are squeezed out, so the result may be shorter. A null
+	 * terminator is NOT written.
+	 *
+	 * @param s The characters to translate.
+	 * @param n The number of characters.
+	 * @return The new number of characters.
+	 */
+	size_t apply(char* s, const size_t n) const noexcept {
+		_STROP("strTranslator::apply", n);
+		_STRLOGF("strTranslator::apply(char*, size_t): {}", n);
+		return __StrSimd::translate(s, s, n, table);
+	}
+
+	/**
+	 * @brief Translates a null-terminated string in place.
+	 *
+	 * @param s The C-string to translate; it stays null-terminated.
+	 * @return The new length.
+	 */
+	size_t apply(char* s) const {
+		if( __StrUtilExtra.checkInvalidCharPtr(s, "strTranslator::apply(char*)", _STRLOG_SITE_LIMITER()) ) return 0;
+		const size_t n = apply(s, strlen(s));
+		s[n] = '\0';
+		return n;
+	}
+
+	/**
+	 * @brief Translates a character range into a new unique_ptr<char[]>.
+	 *
+	 * @param s The source range.
+	 * @return A unique_ptr<char[]> containing the translated string.
+	 */
+	uniqueStr translate(string_view s) const {
+		_STROP("strTranslator::translate", s.size());
+		_STRLOGF("strTranslator::translate(string_view): {}", s.size());
+		uniqueStr r = std::make_unique_for_overwrite<char[]>(s.size() + 1);
+		const size_t n = __StrSimd::translate(r.get(), s.data(), s.size(), table);
+		r[n] = '\0';
+		return r;
+	}
+
+	/**
+	 * @brief Translates a character range into a `smallStr`.
+	 *
+	 * @param r The result string. It may also be the source.
+	 * @param s The source range.
+	 */
+	void translate(smallStr& r, string_view s) const {
+		_STROP("strTranslator::translate", s.size());
+		_STRLOGF("strTranslator::translate(smallStr, string_view): {}", s.size());
+		if( !s.empty() && s.data() == r.data() ) {
+			// `s` starts at our own buffer: translate it in place.
+			r.truncate(__StrSimd::translate(r.data(), r.data(), s.size(), table));
+			return;
+		}
+		if( !s.empty() && s.data() < r.data() + r.size() && r.data() < s.data() + s.size() ) {
+			smallStr tmp(r.memoryResource());
+			char* d = tmp.reset(s.size());
+			tmp.truncate(__StrSimd::translate(d, s.data(), s.size(), table));
+			r = std::move(tmp);
+			return;
+		}
+		char* d = r.reset(s.size());
+		r.truncate(__StrSimd::translate(d, s.data(), s.size(), table));
+	}
+};
@@ -0,0 +1,345 @@
+/**
+ * @file strutf8.hh
+ * @author Ian Hylton
+ * @brief UTF-8 aware case mapping and case-insensitive search.
+ * @version 1.0.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) zperk 2024
+ *
+ */
+
+#pragma once
+
+#include "strlogger.hh"
+#include "strprofile.hh"
+#include "strsimd.hh"
+#include "strtools.hh"
+#include "strunicase.hh"
+#include "strutil.hh"
+#include "strutilhelper.hh"
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using std::string_view, std::to_string;
+
+/**
+ * @class __StrUtf8
+ * @brief UTF-8 decoding, encoding and table-driven case mapping.
+ *
+ * Case mapping runs in two passes: the first measures the result (a mapping
+ * may change the encoded length, e.g. U+023A -> U+2C65 grows from two to
+ * three bytes), the second writes it. Both passes skip ASCII runs with
+ * `__StrSimd::asciiPrefix`, and the second converts them with
+ * `__StrSimd::asciiCase`, so ASCII text costs the same as `strUtil::toLower`.
+ *
+ * Malformed sequences are copied byte by byte and never mapped.
+ */
+class __StrUtf8 {
+public:
+	/// @brief The case mapping to apply.
+	enum class Mode {
+		LOWER,
+		UPPER,
+		FOLD,
+	};
+
+	/// @brief Returned by `decode` for a byte that does not start a valid sequence.
+	static constexpr uint32_t invalid = 0xFFFFFFFF;
+
+	/**
+	 * @brief Decodes one code point.
+	 *
+	 * Overlong forms, surrogates and values above U+10FFFF are rejected.
+	 *
+	 * @param s The characters, starting at a non-ASCII byte.
+	 * @param n The number of characters available (at least 1).
+	 * @param len Receives the number of bytes consumed (1 for `invalid`).
+	 * @return The code point, or `invalid`.
+	 */
+	static uint32_t decode(const char* s, const size_t n, size_t& len) noexcept {
+		const unsigned char* u = reinterpret_cast<const unsigned char*>( s );
+		len = 1;
+		if( u[0] < 0x80 ) return u[0];
+
+		size_t need;
+		uint32_t cp, min;
+		if( ( u[0] & 0xE0 ) == 0xC0 ) { need = 2; cp = u[0] & 0x1F; min = 0x80; }
+		else if( ( u[0] & 0xF0 ) == 0xE0 ) { need = 3; cp = u[0] & 0x0F; min = 0x800; }
+		else if( ( u[0] & 0xF8 ) == 0xF0 ) { need = 4; cp = u[0] & 0x07; min = 0x10000; }
+		else return invalid;
+
+		if( need > n ) return invalid;
+		for( size_t k = 1; k < need; ++k ) {
+			if( ( u[k] & 0xC0 ) != 0x80 ) return invalid;
+			cp = ( cp << 6 ) | ( u[k] & 0x3F );
+		}
+		if( cp < min || cp > 0x10FFFF || ( cp >= 0xD800 && cp <= 0xDFFF ) ) return invalid;
+		len = need;
+		return cp;
+	}
+
+	/**
+	 * @brief Gets the number of bytes needed to encode a valid code point.
+	 */
+	static size_t encodedSize(const uint32_t cp) noexcept {
+		return cp < 0x80 ? 1 : cp < 0x800 ? 2 : cp < 0x10000 ? 3 : 4;
+	}
+
+	/**
+	 * @brief Encodes a valid code point.
+	 *
+	 * @return The number of bytes written.
+	 */
+	static size_t encode(const uint32_t cp, char* dst) noexcept {
+		unsigned char* d = reinterpret_cast<unsigned char*>( dst );
+		if( cp < 0x80 ) {
+			d[0] = static_cast<unsigned char>( cp );
+			return 1;
+		}
+		if( cp < 0x800 ) {
+			d[0] = static_cast<unsigned char>( 0xC0 | ( cp >> 6 ) );
+			d[1] = static_cast<unsigned char>( 0x80 | ( cp & 0x3F ) );
+			return 2;
+		}
+		if( cp < 0x10000 ) {
+			d[0] = static_cast<unsigned char>( 0xE0 | ( cp >> 12 ) );
+			d[1] = static_cast<unsigned char>( 0x80 | ( ( cp >> 6 ) & 0x3F ) );
+			d[2] = static_cast<unsigned char>( 0x80 | ( cp & 0x3F ) );
+			return 3;
+		}
+		d[0] = static_cast<unsigned char>( 0xF0 | ( cp >> 18 ) );
+		d[1] = static_cast<unsigned char>( 0x80 | ( ( cp >> 12 ) & 0x3F ) );
+		d[2] = static_cast<unsigned char>( 0x80 | ( ( cp >> 6 ) & 0x3F ) );
+		d[3] = static_cast<unsigned char>( 0x80 | ( cp & 0x3F ) );
+		return 4;
+	}
+
+	/**
+	 * @brief Maps one code point.
+	 *
+	 * @param cp A code point (ASCII included).
+	 * @param mode The mapping to apply.
+	 * @return The mapped code point, or `cp` if it has no one-to-one mapping.
+	 */
+	static uint32_t map(const uint32_t cp, const Mode mode) noexcept {
+		if( cp < 0x80 ) {
+			const bool upper = mode == Mode::UPPER;
+			const uint32_t first = upper ? 'a' : 'A';
+			return cp - first < 26 ? cp ^ 0x20 : cp;
+		}
+		switch( mode ) {
+		case Mode::LOWER: return lookup(cp, __strUniLower, std::size(__strUniLower));
+		case Mode::UPPER: return lookup(cp, __strUniUpper, std::size(__strUniUpper));
+		default: return lookup(cp, __strUniFold, std::size(__strUniFold));
+		} // switch( mode )
+	}
+
+	/**
+	 * @brief Gets the byte length of `s` after mapping.
+	 */
+	static size_t mappedSize(string_view s, const Mode mode) noexcept {
+		size_t i = 0, w = 0;
+		while( i < s.size() ) {
+			if( (unsigned char) s[i] < 0x80 ) {
+				const size_t ascii = __StrSimd::asciiPrefix(s.data() + i, s.size() - i);
+				i += ascii;
+				w += ascii;
+				if( i == s.size() ) break;
+			}
+
+			size_t len;
+			const uint32_t cp = decode(s.data() + i, s.size() - i, len);
+			w += cp == invalid ? 1 : encodedSize(map(cp, mode));
+			i += len;
+		}
+		return w;
+	}
+
+	/**
+	 * @brief Writes the mapped `s` to `dst`, which holds `mappedSize(s, mode)` bytes.
+	 */
+	static void mapInto(char* dst, string_view s, const Mode mode) noexcept {
+		size_t i = 0, w = 0;
+		while( i < s.size() ) {
+			// Non-ASCII text (Cyrillic, CJK, ...) rarely has long ASCII runs.
+			const size_t ascii = (unsigned char) s[i] < 0x80 ? __StrSimd::asciiPrefix(s.data() + i, s.size() - i) : 0;
+			if( ascii ) {
+				if( ascii < 16 ) {
+					for( size_t k = 0; k < ascii; ++k ) dst[w + k] = static_cast<char>( map((unsigned char) s[i + k], mode) );
+				} else {
+					__StrSimd::asciiCaseCopy(dst + w, s.data() + i, ascii, mode == Mode::UPPER);
+				}
+				i += ascii;
+				w += ascii;
+				if( i == s.size() ) break;
+			}
+
+			size_t len;
+			const uint32_t cp = decode(s.data() + i, s.size() - i, len);
+			if( cp == invalid ) dst[w++] = s[i];
+			else w += encode(map(cp, mode), dst + w);
+			i += len;
+		}
+	}
+
+	/**
+	 * @brief Maps a range into a new null-terminated buffer.
+	 */
+	static uniqueStr convert(string_view s, const Mode mode) {
+		// Pure ASCII keeps its length, so the measuring pass can be skipped.
+		const bool ascii = __StrSimd::asciiPrefix(s.data(), s.size()) == s.size();
+		const size_t n = ascii ? s.size() : mappedSize(s, mode);
+		uniqueStr r = std::make_unique<char[]>(n + 1);
+		mapInto(r.get(), s, mode);
+		r[n] = '\0';
+		return r;
+	}
+
+	/**
+	 * @brief Decodes and case-folds the code point at `s[i]`.
+	 *
+	 * Malformed bytes are returned as `0x110000 + byte`, which never equals a
+	 * real code point, so they only match the same malformed byte.
+	 *
+	 * @param len Receives the number of bytes consumed.
+	 */
+	static uint32_t foldAt(string_view s, const size_t i, size_t& len) noexcept {
+		const uint32_t cp = decode(s.data() + i, s.size() - i, len);
+		if( cp == invalid ) return 0x110000 + (unsigned char) s[i];
+		return map(cp, Mode::FOLD);
+	}
+
+private:
+	static uint32_t lookup(const uint32_t cp, const __StrUniCaseRange* table, const size_t count) noexcept {
+		// Find the last range starting at or before `cp` (branchless halving).
+		if( cp < table[0].first ) return cp;
+		const __StrUniCaseRange* base = table;
+		for( size_t n = count; n > 1; n -= n / 2 ) {
+			base = base[n / 2].first <= cp ? base + n / 2 : base;
+		}
+		const __StrUniCaseRange& r = *base;
+		if( cp > r.last || ( cp - r.first ) % r.stride != 0 ) return cp;
+		return static_cast<uint32_t>( static_cast<int32_t>( cp ) + r.delta );
+	}
+};
+
+namespace strUtil {
+	/**
+	 * @brief Converts UTF-8 text to lowercase.
+	 *
+	 * Unlike `toLower`, which works byte by byte, this maps every code point
+	 * with the Unicode simple (one-to-one) lowercase mapping. Runs of ASCII are
+	 * converted with SIMD. Malformed bytes are copied unchanged.
+	 *
+	 * @param s The UTF-8 source.
+	 * @return A unique_ptr<char[]> containing the lowercase string.
+	 *
+	 * @note Example usage:
+	 * @code
+	 * auto lower = strUtil::utf8ToLower("ÀÉÎ Straße"); // "àéî straße"
+	 * @endcode
+	 */
+	static uniqueStr utf8ToLower(string_view s) {
+		_STROP("utf8ToLower", s.size());
+		_STRLOGF("utf8ToLower(string_view): {}", s.size());
+		return __StrUtf8::convert(s, __StrUtf8::Mode::LOWER);
+	}
+
+	/**
+	 * @brief Converts UTF-8 text to uppercase.
+	 *
+	 * Characters whose uppercase form has several code points (e.g. 'ß') are
+	 * kept as they are.
+	 *
+	 * @param s The UTF-8 source.
+	 * @return A unique_ptr<char[]> containing the uppercase string.
+	 */
+	static uniqueStr utf8ToUpper(string_view s) {
+		_STROP("utf8ToUpper", s.size());
+		_STRLOGF("utf8ToUpper(string_view): {}", s.size());
+		return __StrUtf8::convert(s, __StrUtf8::Mode::UPPER);
+	}
+
+	/**
+	 * @brief Case-folds UTF-8 text for case-insensitive comparison.
+	 *
+	 * Folding is like lowercasing but also merges variants such as final
+	 * sigma and 'ſ'. Two strings are equal ignoring case when their folded
+	 * forms are equal.
+	 *
+	 * @param s The UTF-8 source.
+	 * @return A unique_ptr<char[]> containing the folded string.
+	 */
+	static uniqueStr utf8Fold(string_view s) {
+		_STROP("utf8Fold", s.size());
+		_STRLOGF("utf8Fold(string_view): {}", s.size());
+		return __StrUtf8::convert(s, __StrUtf8::Mode::FOLD);
+	}
+}
+
+namespace strTools {
+	/**
+	 * @brief Finds the first occurrence of a substring, ignoring case in UTF-8.
+	 *
+	 * Both strings are compared code point by code point after case folding,
+	 * without building folded copies of `s`. If both are pure ASCII this is
+	 * `findSubStr`. Matches may differ in byte length from `find` (e.g. the
+	 * Kelvin sign matches 'k').
+	 *
+	 * @param s The UTF-8 source.
+	 * @param find The UTF-8 substring to find.
+	 * @return The byte index of the first occurrence, or INT64_MAX if not found.
+	 *
+	 * @note Example usage:
+	 * @code
+	 * int64_t index = strTools::findSubStrUtf8("Grüße aus KÖLN", "köln");
+	 * // index will be 12
+	 * @endcode
+	 */
+	int64_t findSubStrUtf8(string_view s, string_view find) {
+		_STROP("findSubStrUtf8", s.size());
+		_STRLOGF("findSubStrUtf8(string_view, string_view): {}, {}", s.size(), find.size());
+		if( __StrSimd::asciiPrefix(s.data(), s.size()) == s.size()
+			&& __StrSimd::asciiPrefix(find.data(), find.size()) == find.size() ) {
+			return findSubStr(s, find);
+		}
+
+		if( s.empty() ) {
+			_STRLOGF_LIMIT_AT(__StrToolsLogLvl::ERROR, "findSubStrUtf8: returned: {}", INT64_MAX);
+			return INT64_MAX;
+		}
+
+		if( find.empty() ) {
+			_STRLOGF_LIMIT_AT(__StrToolsLogLvl::WARNING, "findSubStrUtf8: returned: {}", 0);
+			return 0; // Empty substring is always found at the start.
+		}
+
+		std::vector<uint32_t> pattern;
+		pattern.reserve(find.size());
+		for( size_t k = 0, len; k < find.size(); k += len ) {
+			pattern.push_back(__StrUtf8::foldAt(find, k, len));
+		}
+
+		for( size_t i = 0, first; i < s.size(); i += first ) {
+			if( __StrUtf8::foldAt(s, i, first) != pattern[0] ) continue;
+			size_t j = i + first, p = 1, len;
+			while( p < pattern.size() && j < s.size() && __StrUtf8::foldAt(s, j, len) == pattern[p] ) {
+				j += len;
+				++p;
+			}
+			if( p == pattern.size() ) {
+				_STRLOGF("findSubStrUtf8: returned: {}", i);
+				return static_cast<int64_t>( i );
+			}
+		}
+
+		_STRLOGF_LIMIT_AT(__StrToolsLogLvl::ERROR, "findSubStrUtf8: returned: {}", INT64_MAX);
+		return INT64_MAX;
+	}
+}
@@ -13,6 +13,8 @@
 #pragma once
 
 #include "strlogger.hh"
+#include "strprofile.hh"
+#include "strsimd.hh"
 #include "strutilhelper.hh"
 #include <cctype>
 #include <cstdint>
@@ -53,7 +55,7 @@ namespace strUtil {
 	 */
 	void clearScr() noexcept {
 		if( !__strToolsLogger.loggerStatus() ) {
-			_strLogger("clearScr()", "Clear screen");
+			_STRLOG("clearScr()", "Clear screen");
 			cout << "\x1B[2J\x1B[H" << flush;
 		}
 	}
@@ -62,9 +64,28 @@ namespace strUtil {
 	 * @brief Converts a string to lowercase (in-place).
 	 *
 	 * This function modifies the input string by converting all uppercase characters
-	 * to lowercase. It iterates over each character and applies the `tolower` function.
+	 * to lowercase. ASCII letters are converted 16-64 bytes at a time (see
+	 * `__StrSimd::asciiCase`); only bytes above 0x7F go through `tolower`.
 	 *
-	 * @param str The input string to be modified.
+	 * @param src The input string to be modified.
+	 * @param n The number of characters to convert.
+	 *
+	 * @note Modifies the original string.
+	 */
+	void toLower(char* src, const uint64_t n) {
+		_STROP("toLower", n);
+		_STRLOGF("toLower(char*, uint64_t): {}", n);
+		__StrSimd::asciiCase(src, n, false, tolower);
+	}
+
+	/**
+	 * @brief Converts a string to lowercase (in-place).
+	 *
+	 * This function modifies the input string by converting all uppercase characters
+	 * to lowercase. ASCII letters are converted 16-64 bytes at a time (see
+	 * `__StrSimd::asciiCase`); only bytes above 0x7F go through `tolower`.
+	 *
+	 * @param src The input string to be modified.
 	 *
 	 * @note Modifies the original string.
 	 *
@@ -75,17 +96,36 @@ namespace strUtil {
 	 * @endcode
 	 */
 	void toLower(char* src) {
-		_strLogger("toLower()", src);
-		__StrUtilExtra.toSomething(src, tolower);
+		if( __StrUtilExtra.checkInvalidCharPtr(src, "toLower(char*)", _STRLOG_SITE_LIMITER()) ) return;
+		toLower(src, strlen(src));
+	}
+
+	/**
+	 * @brief Converts a string to uppercase (in-place).
+	 *
+	 * This function modifies the input string by converting all lowercase characters
+	 * to uppercase. ASCII letters are converted 16-64 bytes at a time (see
+	 * `__StrSimd::asciiCase`); only bytes above 0x7F go through `toupper`.
+	 *
+	 * @param src The input string to be modified.
+	 * @param n The number of characters to convert.
+	 *
+	 * @note Modifies the original string.
+	 */
+	void toUpper(char* src, const uint64_t n) {
+		_STROP("toUpper", n);
+		_STRLOGF("toUpper(char*, uint64_t): {}", n);
+		__StrSimd::asciiCase(src, n, true, toupper);
 	}
 
 	/**
 	 * @brief Converts a string to uppercase (in-place).
 	 *
 	 * This function modifies the input string by converting all lowercase characters
-	 * to uppercase. It iterates over each character and applies the `toupper` function.
+	 * to uppercase. ASCII letters are converted 16-64 bytes at a time (see
+	 * `__StrSimd::asciiCase`); only bytes above 0x7F go through `toupper`.
 	 *
-	 * @param str The input string to be modified.
+	 * @param src The input string to be modified.
 	 *
 	 * @note Modifies the original string.
 	 *
@@ -96,8 +136,8 @@ namespace strUtil {
 	 * @endcode
 	 */
 	void toUpper(char* src) {
-		_strLogger("toUpper()", src);
-		__StrUtilExtra.toSomething(src, toupper);
+		if( __StrUtilExtra.checkInvalidCharPtr(src, "toUpper(char*)", _STRLOG_SITE_LIMITER()) ) return;
+		toUpper(src, strlen(src));
 	}
 
 	/**
@@ -118,7 +158,7 @@ namespace strUtil {
 	 */
 	template<class T>
 	static T makeSmartPtrArray(uint64_t size) noexcept {
-		_strLogger("makeSmartPtrArray()", "creating smart string with size: " + to_string(size));
+		_STRLOGF("makeSmartPtrArray(): creating smart string with size: {}", size);
 		if( size == 0 ) size = 1;
 		return T(new char[size]);
 	}
@@ -142,9 +182,9 @@ namespace strUtil {
 	 */
 	template<class T>
 	static T makeSmartStr(const char* src) noexcept {
-		_strLogger("makeSmartStr()", "creating smart string using: " + to_string(*src));
+		_STRLOGF("makeSmartStr(): creating smart string using: {}", static_cast<int>( *src ));
 		// If the pointer is a nullptr, return an empty string.
-		if( __StrUtilExtra.checkInvalidCharPtr(src, "makeSmartStr()") ) {
+		if( __StrUtilExtra.checkInvalidCharPtr(src, "makeSmartStr()", _STRLOG_SITE_LIMITER()) ) {
 			return strUtil::makeSmartPtrArray<T>(1);
 		}
 		return __StrUtilExtra.makeSmartPtr<T>(src);
@@ -166,12 +206,15 @@ namespace strUtil {
 	 * @endcode
 	 */
 	uniqueStr toLower(const char* src) {
-		if( __StrUtilExtra.checkInvalidCharPtr(src, "toLower(const char*)") ) {
-			return strUtil::makeSmartPtrArray<uniqueStr>(1);
+		if( __StrUtilExtra.checkInvalidCharPtr(src, "toLower(const char*)", _STRLOG_SITE_LIMITER()) ) {
+			auto empty = strUtil::makeSmartPtrArray<uniqueStr>(1);
+			empty[0] = '\0';
+			return empty;
 		}
-		uniqueStr s(new char[sizeof(src)]);
-		strcpy(s.get(), src);
-		toLower(s.get());
+		const auto n = strlen(src);
+		uniqueStr s(new char[n + 1]);
+		memcpy(s.get(), src, n + 1);
+		toLower(s.get(), n);
 		return s;
 	}
 
@@ -191,12 +234,15 @@ namespace strUtil {
 	 * @endcode
 	 */
 	uniqueStr toUpper(const char* src) {
-		if( __StrUtilExtra.checkInvalidCharPtr(src, "toUpper(const char*)") ) {
-			return strUtil::makeSmartPtrArray<uniqueStr>(1);
+		if( __StrUtilExtra.checkInvalidCharPtr(src, "toUpper(const char*)", _STRLOG_SITE_LIMITER()) ) {
+			auto empty = strUtil::makeSmartPtrArray<uniqueStr>(1);
+			empty[0] = '\0';
+			return empty;
 		}
-		uniqueStr s(new char[sizeof(src)]);
-		strcpy(s.get(), src);
-		toUpper(s.get());
+		const auto n = strlen(src);
+		uniqueStr s(new char[n + 1]);
+		memcpy(s.get(), src, n + 1);
+		toUpper(s.get(), n);
 		return s;
 	}
 
@@ -268,17 +314,13 @@ namespace strUtil {
 	bool isCapturedValueInvalid(char value = '\n', bool force = false) {
 		// If `force` is enabled, ignore the captured value.
 		if( force ) {
-			__strToolsLogger.log(__StrToolsLogLvl::INFO,
-				"isCapturedValueInvalid(..., bool): Invalid input: " + value
-			);
+			_STRLOG("isCapturedValueInvalid(..., bool)", "Invalid input: " + string(1, value));
 			__StrUtilExtra.ignoreCapturedValue(value);
 			return true;
 		}
 
 		if( cin.fail() ) {
-			__strToolsLogger.log(
-				__StrToolsLogLvl::INFO, "isCapturedValueInvalid(char, ...): The stream failed."
-			);
+			_STRLOG("isCapturedValueInvalid(char, ...)", "The stream failed.");
 			// Clear the error flags so we can use `cin` again.
 			cin.clear();
 			// Ignore invalid input.
@@ -286,7 +328,7 @@ namespace strUtil {
 			return true;
 		}
 
-		__strToolsLogger.log(__StrToolsLogLvl::INFO, "isCapturedValueInvalid(...): No errors.");
+		_STRLOG("isCapturedValueInvalid(...)", "No errors.");
 		return false;
 	}
 
@@ -11,7 +11,9 @@
 
 #pragma once
 
+#include "strlogbin.hh"
 #include "strlogger.hh"
+#include "strloglimit.hh"
 #include <cstring>
 #include <iosfwd>
 #include <iostream>
@@ -23,9 +25,87 @@ using std::cin, std::cerr, std::endl, std::numeric_limits;
 using std::string, std::to_string;
 
 static void _strLogger(const string& from, const string& s, __StrToolsLogLvl lvl = __StrToolsLogLvl::INFO) {
-	return __strToolsLogger.log(lvl, from + ": " + s);
+	if( __strToolsLogger.isBinary() ) {
+		// One site per level, with `from` and `s` as string arguments.
+		static __StrLogSite sites[] = {
+			{ __StrToolsLogLvl::INFO, __FILE__, __LINE__, "{}: {}", __StrLogArgs<string, string> {} },
+			{ __StrToolsLogLvl::WARNING, __FILE__, __LINE__, "{}: {}", __StrLogArgs<string, string> {} },
+			{ __StrToolsLogLvl::ERROR, __FILE__, __LINE__, "{}: {}", __StrLogArgs<string, string> {} },
+		};
+		return __StrLogBinary::log(sites[static_cast<int>( lvl )], from, s);
+	}
+	string& record = __StrLogger::threadBuffer();
+	record += from;
+	record += ": ";
+	record += s;
+	__strToolsLogger.commit(lvl, record);
 }
 
+/**
+ * @brief Logs a message at `lvl` without building it unless it is written.
+ *
+ * `from` and `msg` are only evaluated when the logger is enabled, so a
+ * disabled logger costs one branch and no `std::string` is constructed.
+ * Below `STRTOOLS_LOG_MIN_LEVEL` the statement compiles to nothing.
+ *
+ * @note Example usage:
+ * @code
+ * _STRLOG_AT(__StrToolsLogLvl::ERROR, "findSubStr", "returned: " + to_string(i));
+ * @endcode
+ */
+#define _STRLOG_AT(lvl, from, msg) \
+	do { \
+		if constexpr( static_cast<int>( lvl ) >= STRTOOLS_LOG_MIN_LEVEL ) { \
+			if( __strToolsLogger.loggerStatus() ) _strLogger(( from ), ( msg ), ( lvl )); \
+		} \
+	} while( 0 )
+
+/**
+ * @brief Logs an INFO message lazily (see `_STRLOG_AT`).
+ */
+#define _STRLOG(from, msg) _STRLOG_AT(__StrToolsLogLvl::INFO, from, msg)
+
+/**
+ * @brief Logs lazily like `_STRLOG_AT`, but through the rate limiter `limiter`.
+ *
+ * The number of suppressed messages is logged just before the next message
+ * that gets through, and once per `STRTOOLS_LOG_REPORT_MS` while messages
+ * keep being suppressed.
+ *
+ * @note Example usage:
+ * @code
+ * _STRLOG_LIMIT_WITH(site, __StrToolsLogLvl::ERROR, from, "bad header");
+ * @endcode
+ */
+#define _STRLOG_LIMIT_WITH(limiter, lvl, from, msg) \
+	do { \
+		if constexpr( static_cast<int>( lvl ) >= STRTOOLS_LOG_MIN_LEVEL ) { \
+			if( __strToolsLogger.loggerStatus() ) { \
+				uint64_t __strLogSkipped = 0; \
+				const bool __strLogPass = ( limiter ).allow(__strLogSkipped); \
+				if( __strLogSkipped ) \
+					_strLogger(( from ), to_string(__strLogSkipped) + " similar messages suppressed.", ( lvl )); \
+				if( __strLogPass ) _strLogger(( from ), ( msg ), ( lvl )); \
+			} \
+		} \
+	} while( 0 )
+
+/**
+ * @brief Logs lazily like `_STRLOG_AT`, but rate limited per call site.
+ *
+ * Each use of the macro gets its own `__StrLogLimiter`: one message in
+ * `STRTOOLS_LOG_SAMPLE` is considered, and of those at most
+ * `STRTOOLS_LOG_BURST` back to back and `STRTOOLS_LOG_RATE` per second are
+ * written (see `_STRLOG_LIMIT_WITH` for the suppressed counts). Use it for
+ * messages an error storm can trigger on every call.
+ *
+ * @note Example usage:
+ * @code
+ * _STRLOG_LIMIT_AT(__StrToolsLogLvl::ERROR, "parse", "bad header: " + line);
+ * @endcode
+ */
+#define _STRLOG_LIMIT_AT(lvl, from, msg) _STRLOG_LIMIT_WITH(_STRLOG_SITE_LIMITER(), lvl, from, msg)
+
 class __StrUtilHelper {
 private:
 	string __strUtilLoggerFilePath;
@@ -48,7 +128,7 @@ public:
 	 * @endcode
 	 */
 	void ignoreCapturedValue(char s, bool doClear = true) noexcept {
-		_strLogger("ignoreCapturedValue(char, bool)", to_string(s) + ", " + to_string(doClear));
+		_STRLOG("ignoreCapturedValue(char, bool)", to_string(s) + ", " + to_string(doClear));
 		if( doClear ) cin.clear();
 		cin.ignore(numeric_limits<std::streamsize>::max(), s);
 	}
@@ -62,20 +142,21 @@ public:
 	 *
 	 * @param rule The condition to be checked. If this condition evaluates to true, an exception is thrown.
 	 * @param msg The message to be included in the exception if the rule is violated.
+	 * @param site The caller's rate limiter for the violation warning.
 	 * @throws std::out_of_range if the rule is true.
 	 *
 	 * @note Example usage:
 	 * @code
-	 * checkLogicErrors(index < arraySize, "Index out of range");
+	 * checkLogicErrors(index < arraySize, "Index out of range", _STRLOG_SITE_LIMITER());
 	 * @endcode
 	 */
-	void checkLogicErrors(bool rule, const string& msg) {
-		_strLogger(
-			"checkLogicErrors(bool, string)",
-			( rule ? "true, " + msg : "false." ),
-			__StrToolsLogLvl::WARNING
-		);
-		if( rule ) throw std::runtime_error(msg);
+	void checkLogicErrors(bool rule, const char* msg, __StrLogLimiter& site) {
+		if( !rule ) {
+			_STRLOG("checkLogicErrors(bool, char*)", "false.");
+			return;
+		}
+		_STRLOG_LIMIT_WITH(site, __StrToolsLogLvl::WARNING, "checkLogicErrors(bool, char*)", "true, " + string(msg));
+		throw std::runtime_error(msg);
 	}
 
 	/**
@@ -96,8 +177,8 @@ public:
 	 * @endcode
 	 */
 	void toSomething(char* s, int ( *f )( int )) {
-		if( this->checkInvalidCharPtr(s, "toUpper(char*)") ) return;
-		_strLogger("toSomething(char*, *func)", to_string(*s) + ", func");
+		if( this->checkInvalidCharPtr(s, "toUpper(char*)", _STRLOG_SITE_LIMITER()) ) return;
+		_STRLOG("toSomething(char*, *func)", to_string(*s) + ", func");
 		for( int i = 0; s[i]; i++ ) {
 			s[i] = f((unsigned char) s[i]);
 		}
@@ -111,21 +192,24 @@ public:
 	 * for validating character pointers before performing operations on them.
 	 *
 	 * @param c The character pointer to be checked.
+	 * @param from The caller, for the log message.
+	 * @param site The caller's rate limiter for the log message.
 	 *
 	 * @throws std::invalid_argument if the character pointer is `nullptr`.
 	 *
 	 * @note Example usage:
 	 * @code
 	 * char* myString = nullptr;
-	 * checkInvalidCharPtr(myString); // Throws an exception with the message.
+	 * checkInvalidCharPtr(myString, "caller()", _STRLOG_SITE_LIMITER()); // Throws an exception with the message.
 	 * @endcode
 	 */
-	bool checkInvalidCharPtr(const char* s, const string& from) noexcept {
+	bool checkInvalidCharPtr(const char* s, const char* from, __StrLogLimiter& site) noexcept {
 		if( s == nullptr || *s == '\0' ) {
-			_strLogger(
+			_STRLOG_LIMIT_WITH(
+				site,
+				__StrToolsLogLvl::ERROR,
 				from,
-				"Expected a valid character pointer but a nullptr was received.",
-				__StrToolsLogLvl::ERROR
+				"Expected a valid character pointer but a nullptr was received."
 			);
 			return true;
 		}
@@ -151,9 +235,9 @@ public:
 	 */
 	template <class T>
 	T makeSmartPtr(const char* src) noexcept {
-		_strLogger("makeSmartPtr()", src);
+		_STRLOG("makeSmartPtr()", src);
 		// If invalid, return the T to a null terminator.
-		if( this->checkInvalidCharPtr(src, "__makeSmartPtr(const char*)") ) {
+		if( this->checkInvalidCharPtr(src, "__makeSmartPtr(const char*)", _STRLOG_SITE_LIMITER()) ) {
 			T empty(new char[1]);
 			empty[0] = '\0'; // Set the null terminator
 			return empty;
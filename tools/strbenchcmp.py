@@ -0,0 +1,201 @@
+#!/usr/bin/env python3
+"""
+@file strbenchcmp.py
+@author Ian Hylton
+@brief Compares strtools_bench results with a stored baseline and fails on regressions.
+@version 1.0.0
+@date 2026-10-17
+
+@copyright Copyright (c) zperk 2024
+
+Every case is compared on the ratio of its median ns/op to the baseline's.
+Both sides are bootstrapped to get a confidence interval for that ratio:
+runs are resampled first, then the samples within each picked run. Timings
+often shift as a whole from one process to the next (placement, frequency,
+neighbours), so the runs, not the samples, are what vary independently. A
+case has regressed only when the whole interval lies above 1 + threshold
+and even its fastest run is that much slower than the baseline's median:
+a noisy case needs a clear, consistent slowdown to fail, while a stable
+one fails as soon as it is really slower.
+
+The benchmark can be run here (--bench, repeated --runs times, with the
+arguments recorded in the baseline) or its JSON output can be passed in
+(--current). --update writes the pooled results as the new baseline.
+
+Usage:
+    python3 tools/strbenchcmp.py --baseline bench/baseline.json --bench build/strtools_bench [--runs 5]
+    python3 tools/strbenchcmp.py --baseline bench/baseline.json --current a.json b.json
+    python3 tools/strbenchcmp.py --baseline bench/baseline.json --bench build/strtools_bench --update
+
+Exit status: 0 if nothing regressed, 1 on a regression, 2 on bad input.
+"""
+
+import argparse
+import json
+import os
+import random
+import shlex
+import statistics
+import subprocess
+import sys
+import tempfile
+
+# Default benchmark arguments when the baseline records none: every function
+# at two sizes, with short samples.
+DEFAULT_ARGS = ["--quick", "--filter=/1KiB,/64KiB"]
+
+RESAMPLES = 2000
+
+
+def load(path):
+    """Reads a strtools_bench JSON file."""
+    with open(path, encoding="utf-8") as f:
+        return json.load(f)
+
+
+def run_bench(bench, args, runs):
+    """Runs the benchmark `runs` times and returns the parsed outputs."""
+    results = []
+    for i in range(runs):
+        fd, path = tempfile.mkstemp(suffix=".json")
+        os.close(fd)
+        try:
+            print(f"run {i + 1}/{runs}: {bench} {' '.join(args)}", file=sys.stderr)
+            subprocess.run([bench, *args, "--json=" + path], check=True, stdout=subprocess.DEVNULL)
+            results.append(load(path))
+        finally:
+            os.remove(path)
+    return results
+
+
+def pool(results):
+    """Merges several runs; each case keeps the samples of every run apart in `runs_ns`."""
+    cases = {}
+    for result in results:
+        for b in result["benchmarks"]:
+            case = cases.setdefault(b["id"], dict(b, samples_ns=[], runs_ns=[]))
+            for run in b.get("runs_ns", [b["samples_ns"]]):
+                case["runs_ns"].append(run)
+                case["samples_ns"].extend(run)
+    for case in cases.values():
+        case["ns_per_op"] = statistics.median(case["samples_ns"])
+        case["gb_per_s"] = case["bytes"] / case["ns_per_op"] if case["bytes"] and case["ns_per_op"] else 0
+    return cases
+
+
+def resample(runs, rng):
+    """Draws one bootstrap median: runs with replacement, then samples within them."""
+    samples = []
+    for run in rng.choices(runs, k=len(runs)):
+        samples.extend(rng.choices(run, k=len(run)))
+    return statistics.median(samples)
+
+
+def ratio_interval(base, current, confidence, rng):
+    """Bootstraps a confidence interval for median(current) / median(base)."""
+    ratios = []
+    for _ in range(RESAMPLES):
+        b = resample(base, rng)
+        c = resample(current, rng)
+        ratios.append(c / b if b > 0 else 1.0)
+    ratios.sort()
+    tail = (1 - confidence) / 2
+    return ratios[int(tail * (RESAMPLES - 1))], ratios[int((1 - tail) * (RESAMPLES - 1))]
+
+
+def compare(baseline, current, threshold, confidence):
+    """Classifies every case of the baseline; returns rows sorted worst first."""
+    rng = random.Random(0)
+    rows = []
+    for case_id, base in baseline.items():
+        cur = current.get(case_id)
+        if cur is None:
+            rows.append({"id": case_id, "status": "missing"})
+            continue
+        low, high = ratio_interval(base["runs_ns"], cur["runs_ns"], confidence, rng)
+        ratio = cur["ns_per_op"] / base["ns_per_op"] if base["ns_per_op"] > 0 else 1.0
+        fastest = min(statistics.median(run) for run in cur["runs_ns"])
+        if low > 1 + threshold and fastest > base["ns_per_op"] * (1 + threshold):
+            status = "REGRESSED"
+        elif high < 1 - threshold:
+            status = "improved"
+        else:
+            status = "same"
+        rows.append({"id": case_id, "status": status, "base": base["ns_per_op"], "current": cur["ns_per_op"],
+                     "ratio": ratio, "low": low, "high": high})
+    order = {"REGRESSED": 0, "missing": 1, "improved": 2, "same": 3}
+    rows.sort(key=lambda r: (order[r["status"]], -r.get("ratio", 0)))
+    return rows
+
+
+def report(rows, confidence, out):
+    pct = int(round(confidence * 100))
+    print(f"{'case':<44} {'base ns/op':>12} {'now ns/op':>12} {'change':>8}   {pct}% interval      status", file=out)
+    for r in rows:
+        if r["status"] == "missing":
+            print(f"{r['id']:<44} {'':>12} {'':>12} {'':>8}   {'':<17} missing", file=out)
+            continue
+        interval = f"[{(r['low'] - 1) * 100:+.1f}%, {(r['high'] - 1) * 100:+.1f}%]"
+        print(f"{r['id']:<44} {r['base']:>12.1f} {r['current']:>12.1f} {(r['ratio'] - 1) * 100:>+7.1f}%"
+              f"   {interval:<17} {r['status']}", file=out)
+
+
+def check_context(baseline, current):
+    """Warns when the two sides were not built or run alike."""
+    for key in ("compiler", "optimized", "profile", "track_alloc", "args"):
+        b, c = baseline.get(key), current.get(key)
+        if b is not None and c is not None and b != c:
+            print(f"warning: {key} differs from the baseline ({c!r} vs {b!r})", file=sys.stderr)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compares strtools_bench results with a baseline.")
+    parser.add_argument("--baseline", required=True, help="baseline JSON (written by --update)")
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--bench", help="strtools_bench binary to run")
+    source.add_argument("--current", nargs="+", help="strtools_bench JSON outputs to compare")
+    parser.add_argument("--runs", type=int, default=5, help="benchmark runs to pool (default 5)")
+    parser.add_argument("--bench-args", help="benchmark arguments (default: those of the baseline)")
+    parser.add_argument("--threshold", type=float, default=15, help="slowdown in percent that fails (default 15)")
+    parser.add_argument("--confidence", type=float, default=0.95, help="confidence of the interval (default 0.95)")
+    parser.add_argument("--update", action="store_true", help="write the results as the new baseline")
+    args = parser.parse_args()
+
+    baseline = None
+    if os.path.exists(args.baseline):
+        baseline = load(args.baseline)
+    elif not args.update:
+        print(f"Failed to open {args.baseline}", file=sys.stderr)
+        return 2
+
+    if args.bench:
+        if args.bench_args is not None:
+            bench_args = shlex.split(args.bench_args)
+        elif baseline and baseline["context"].get("args"):
+            bench_args = baseline["context"]["args"]
+        else:
+            bench_args = DEFAULT_ARGS
+        results = run_bench(args.bench, bench_args, max(1, args.runs))
+    else:
+        results = [load(path) for path in args.current]
+    current = pool(results)
+
+    if args.update:
+        # One case per line, so a baseline update reads well in a diff.
+        with open(args.baseline, "w", encoding="utf-8") as f:
+            f.write('{\n"context":' + json.dumps(results[0]["context"]) + ',\n"benchmarks":[')
+            f.write(",".join("\n" + json.dumps(case) for case in current.values()))
+            f.write("\n]}\n")
+        print(f"{len(current)} cases written to {args.baseline}", file=sys.stderr)
+        return 0
+
+    check_context(baseline["context"], results[0]["context"])
+    rows = compare(pool([baseline]), current, args.threshold / 100, args.confidence)
+    report(rows, args.confidence, sys.stdout)
+    regressed = sum(r["status"] == "REGRESSED" for r in rows)
+    print(f"\n{regressed} of {len(rows)} cases regressed by more than {args.threshold:g}%.")
+    return 1 if regressed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,58 @@
+/**
+ * @file strlogdecode.cpp
+ * @author Ian Hylton
+ * @brief Converts a strtools binary log back into text.
+ * @version 1.0.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) zperk 2024
+ *
+ * Usage: strlogdecode [-p digits] <binary log> [text output]
+ * Without an output file the text is written to stdout. `-p 3` adds
+ * milliseconds to the timestamps, `-p 9` nanoseconds.
+ */
+
+#include "../src/strlogbin.hh"
+#include <fstream>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+int main(int argc, char** argv) {
+	const char* program = argv[0];
+	unsigned precision = 0;
+	if( argc > 2 && std::strcmp(argv[1], "-p") == 0 ) {
+		precision = static_cast<unsigned>( std::strtoul(argv[2], nullptr, 10) );
+		argv += 2;
+		argc -= 2;
+	}
+	if( argc < 2 ) {
+		std::cerr << "Usage: " << program << " [-p digits] <binary log> [text output]\n";
+		return 2;
+	}
+
+	std::ifstream in(argv[1], std::ios::in | std::ios::binary);
+	if( !in.is_open() ) {
+		std::cerr << "Failed to open " << argv[1] << "\n";
+		return 1;
+	}
+
+	std::ofstream file;
+	if( argc > 2 ) {
+		file.open(argv[2], std::ios::out | std::ios::trunc);
+		if( !file.is_open() ) {
+			std::cerr << "Failed to open " << argv[2] << "\n";
+			return 1;
+		}
+	}
+	std::ostream& out = argc > 2 ? static_cast<std::ostream&>( file ) : std::cout;
+
+	__StrLogDecoder decoder;
+	std::ostringstream err;
+	const uint64_t records = decoder.decode(in, out, err, precision);
+	std::cerr << records << " records decoded.\n";
+	if( decoder.skippedRecords() ) std::cerr << decoder.skippedRecords() << " records skipped.\n";
+	std::cerr << err.str();
+	return err.str().empty() ? 0 : 1;
+}
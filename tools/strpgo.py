@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+"""
+@file strpgo.py
+@author Ian Hylton
+@brief Builds strTools with profile-guided and link-time optimization and reports the speedup.
+
+@version 1.0.0
+@date 2026-10-17
+
+@copyright Copyright (c) zperk 2024
+
+The steps use the CMake presets of CMakePresets.json:
+
+1. `release`: the reference build, optimized without PGO or LTO.
+2. `pgo-generate`: an instrumented build in build/pgo.
+3. Training: the instrumented strtools_bench runs over every benchmark
+   input (quick sizes), then StringTools replays bench/pgo_session.txt,
+   a scripted menu session. With Clang the raw profiles are merged with
+   llvm-profdata.
+4. `pgo-use`: build/pgo is rebuilt with the profiles and LTO.
+5. Both builds run the benchmark, alternating, --runs times each. For every
+   operation (the first part of the case id) the speedup is the geometric
+   mean of release ns/op over PGO+LTO ns/op across its cases.
+
+Usage:
+    python3 tools/strpgo.py [--runs 3] [--json pgo.json]
+    python3 tools/strpgo.py --compare-only --bench-args "--quick --filter=findSubStr"
+
+Exit status: 0 on success, 2 if a step failed.
+"""
+
+import argparse
+import json
+import math
+import os
+import shlex
+import shutil
+import statistics
+import subprocess
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from strbenchcmp import DEFAULT_ARGS, pool, run_bench  # noqa: E402
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+RELEASE_DIR = os.path.join(ROOT, "build", "release")
+PGO_DIR = os.path.join(ROOT, "build", "pgo")
+PROFILE_DIR = os.path.join(PGO_DIR, "pgo-profile")
+SESSION = os.path.join(ROOT, "bench", "pgo_session.txt")
+
+# Training covers every case at small and medium sizes; the counters and
+# the 64-thread cases would only add noise to the profile.
+TRAIN_ARGS = ["--quick", "--no-counters", "--max-threads=4"]
+SESSION_REPEATS = 20
+
+
+def executable(directory, name):
+    path = os.path.join(directory, name)
+    return path + ".exe" if os.name == "nt" else path
+
+
+def cmake(*args):
+    print("+ cmake " + " ".join(args), file=sys.stderr)
+    subprocess.run(["cmake", *args], cwd=ROOT, check=True)
+
+
+def build(preset):
+    cmake("--preset", preset)
+    cmake("--build", "--preset", preset, "--parallel")
+
+
+def train():
+    """Runs the instrumented binaries so they write their profiles."""
+    bench = executable(PGO_DIR, "strtools_bench")
+    print(f"+ {bench} {' '.join(TRAIN_ARGS)}", file=sys.stderr)
+    subprocess.run([bench, *TRAIN_ARGS], check=True, stdout=subprocess.DEVNULL)
+
+    # StringTools logs to ./src/_dump.log, so it runs in a scratch directory.
+    with open(SESSION, "rb") as f:
+        session = f.read()
+    with tempfile.TemporaryDirectory() as scratch:
+        os.mkdir(os.path.join(scratch, "src"))
+        print(f"+ StringTools < {os.path.relpath(SESSION, ROOT)} (x{SESSION_REPEATS})", file=sys.stderr)
+        for _ in range(SESSION_REPEATS):
+            subprocess.run([executable(PGO_DIR, "StringTools")], input=session, cwd=scratch, check=True,
+                           stdout=subprocess.DEVNULL)
+
+
+def merge_profiles():
+    """Clang writes .profraw files that -fprofile-use only reads once merged."""
+    raw = [os.path.join(PROFILE_DIR, name) for name in os.listdir(PROFILE_DIR) if name.endswith(".profraw")]
+    if not raw:
+        return
+    profdata = os.environ.get("LLVM_PROFDATA") or shutil.which("llvm-profdata")
+    if not profdata:
+        raise RuntimeError("llvm-profdata not found; set LLVM_PROFDATA")
+    subprocess.run([profdata, "merge", "-o", os.path.join(PROFILE_DIR, "default.profdata"), *raw], check=True)
+
+
+def speedups(release, optimized):
+    """Groups the cases by operation; returns one row per operation and the overall geometric mean."""
+    ops = {}
+    for case_id, base in release.items():
+        cur = optimized.get(case_id)
+        if cur is None or base["ns_per_op"] <= 0 or cur["ns_per_op"] <= 0:
+            continue
+        ops.setdefault(case_id.split("/")[0], []).append(base["ns_per_op"] / cur["ns_per_op"])
+    rows = []
+    for op, ratios in ops.items():
+        rows.append({"operation": op, "cases": len(ratios), "speedup": geomean(ratios),
+                     "min": min(ratios), "max": max(ratios)})
+    rows.sort(key=lambda r: -r["speedup"])
+    overall = geomean([r for ratios in ops.values() for r in ratios]) if ops else 1.0
+    return rows, overall
+
+
+def geomean(values):
+    return math.exp(statistics.fmean(math.log(v) for v in values))
+
+
+def report(rows, overall, out):
+    print(f"{'operation':<24} {'cases':>5} {'speedup':>9} {'min':>8} {'max':>8}", file=out)
+    for r in rows:
+        print(f"{r['operation']:<24} {r['cases']:>5} {(r['speedup'] - 1) * 100:>+8.1f}%"
+              f" {(r['min'] - 1) * 100:>+7.1f}% {(r['max'] - 1) * 100:>+7.1f}%", file=out)
+    print(f"\nPGO+LTO over release, geometric mean of all cases: {(overall - 1) * 100:+.1f}%", file=out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Builds strTools with PGO and LTO and reports the speedup.")
+    parser.add_argument("--runs", type=int, default=3, help="benchmark runs of each build (default 3)")
+    parser.add_argument("--bench-args", help=f"benchmark arguments (default: {' '.join(DEFAULT_ARGS)})")
+    parser.add_argument("--json", help="also write the per-operation speedups as JSON")
+    parser.add_argument("--compare-only", action="store_true", help="skip building and training")
+    args = parser.parse_args()
+
+    try:
+        if not args.compare_only:
+            build("release")
+            build("pgo-generate")
+            shutil.rmtree(PROFILE_DIR, ignore_errors=True)
+            os.makedirs(PROFILE_DIR)
+            train()
+            merge_profiles()
+            build("pgo-use")
+
+        bench_args = shlex.split(args.bench_args) if args.bench_args is not None else DEFAULT_ARGS
+        bench_args = [*bench_args, "--no-counters"]
+        # Alternate the builds so a drift of the machine hits both alike.
+        release, optimized = [], []
+        for _ in range(max(1, args.runs)):
+            release += run_bench(executable(RELEASE_DIR, "strtools_bench"), bench_args, 1)
+            optimized += run_bench(executable(PGO_DIR, "strtools_bench"), bench_args, 1)
+    except (subprocess.CalledProcessError, OSError, RuntimeError) as e:
+        print(f"strpgo: {e}", file=sys.stderr)
+        return 2
+
+    rows, overall = speedups(pool(release), pool(optimized))
+    report(rows, overall, sys.stdout)
+    if args.json:
+        with open(args.json, "w", encoding="utf-8") as f:
+            json.dump({"context": optimized[0]["context"], "overall": overall, "operations": rows}, f, indent=1)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
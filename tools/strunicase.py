@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+"""
+@file strunicase.py
+@author Ian Hylton
+@brief Generates src/strunicase.hh, the Unicode case tables used by strutf8.hh.
+@version 1.0.0
+@date 2026-10-17
+
+@copyright Copyright (c) zperk 2024
+
+The tables hold the one-to-one (simple) lowercase, uppercase and case-folding
+mappings of every non-ASCII code point known to Python's `unicodedata`.
+Mappings that expand to several code points (e.g. 'ß' -> "SS") are left out,
+so those characters map to themselves.
+
+Consecutive code points with the same delta are merged into one range. A
+range with a stride of 2 covers the alternating upper/lower pairs found in
+Latin Extended-A, Cyrillic, etc. That keeps each table at a few hundred
+entries, small enough for a binary search to stay in cache.
+
+Usage:
+    python3 tools/strunicase.py [output]   # default: src/strunicase.hh
+"""
+
+import os
+import sys
+import unicodedata
+
+MAX_CODE_POINT = 0x10FFFF
+
+
+def single(s):
+    """Returns the only code point of `s`, or None if it has several."""
+    return ord(s) if len(s) == 1 else None
+
+
+def simple_lower(c):
+    return single(c.lower())
+
+
+def simple_upper(c):
+    return single(c.upper())
+
+
+def simple_fold(c):
+    # CaseFolding.txt status C+S: prefer the full folding when it is 1:1,
+    # otherwise fall back to the simple lowercase mapping.
+    folded = single(c.casefold())
+    return folded if folded is not None else simple_lower(c)
+
+
+def mappings(fn):
+    table = {}
+    for cp in range(0x80, MAX_CODE_POINT + 1):
+        if 0xD800 <= cp <= 0xDFFF:
+            continue
+        target = fn(chr(cp))
+        if target is not None and target != cp:
+            table[cp] = target
+    return table
+
+
+def ranges(table):
+    """Merges a {code point: target} map into (first, last, stride, delta)."""
+    out = []
+    for cp in sorted(table):
+        delta = table[cp] - cp
+        if out:
+            first, last, stride, d = out[-1]
+            if d == delta:
+                if stride == 0 and cp - last in (1, 2):
+                    out[-1] = (first, cp, cp - last, d)
+                    continue
+                if stride and cp - last == stride:
+                    out[-1] = (first, cp, stride, d)
+                    continue
+        out.append((cp, cp, 0, delta))
+    return [(first, last, stride or 1, d) for first, last, stride, d in out]
+
+
+def emit(name, rs):
+    lines = ["static constexpr __StrUniCaseRange %s[] = {" % name]
+    for first, last, stride, delta in rs:
+        lines.append("\t{ 0x%05X, 0x%05X, %d, %d }," % (first, last, stride, delta))
+    lines.append("};")
+    return "\n".join(lines)
+
+
+HEADER = """/**
+ * @file strunicase.hh
+ * @author Ian Hylton
+ * @brief Unicode %s simple case mapping tables.
+ * @version 1.0.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) zperk 2024
+ *
+ * GENERATED by tools/strunicase.py; do not edit by hand.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Code points `first`, `first + stride`, ... `last` map to `cp + delta`.
+ *
+ * Ranges are sorted by `first` and never overlap. Code points inside a range
+ * that are not on its stride map to themselves.
+ */
+struct __StrUniCaseRange {
+	uint32_t first;
+	uint32_t last;
+	uint32_t stride;
+	int32_t delta;
+};
+
+/// @brief Unicode version the tables were generated from.
+#define __STRUNICASE_VERSION "%s"
+"""
+
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    path = sys.argv[1] if len(sys.argv) > 1 else os.path.join(root, "src", "strunicase.hh")
+    version = unicodedata.unidata_version
+    body = [(HEADER % (version, version)).rstrip("\n")]
+    for name, fn in (
+        ("__strUniLower", simple_lower),
+        ("__strUniUpper", simple_upper),
+        ("__strUniFold", simple_fold),
+    ):
+        body.append(emit(name, ranges(mappings(fn))))
+    with open(path, "w", newline="\n") as f:
+        f.write("\n\n".join(body) + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,47 @@
+/**
+ * @file strwarncheck.cpp
+ * @author Ian Hylton
+ * @brief The readme examples, compiled with strict warnings by CMake.
+ * @version 1.0.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) zperk 2024
+ *
+ * GCC reports `-Wstringop-overflow` and `-Wstringop-overread` into the
+ * translation unit that calls an inlined function, so a warning in the
+ * headers shows up in the user's build. GCC only sees the bounds when the
+ * helpers are inlined with the constant arguments, so each example is
+ * written as in the readme, once. The object is only compiled, never linked.
+ */
+
+#include "../src/.hxx"
+
+// Each example returns its result, so none of them is optimized away.
+
+uniqueStr warnCheckConcat() {
+	return strTools::concatStr("Hello, ", "World!");
+}
+
+uniqueStr warnCheckFrame(string_view frame) {
+	return strTools::concatStr(frame, "\r\n");
+}
+
+uniqueStr warnCheckSmall() {
+	smallStr key;
+	strTools::concatStr(key, "user:", "1234");
+	return std::move(key).toUniqueStr();
+}
+
+uniqueStr warnCheckArena() {
+	std::pmr::monotonic_buffer_resource arena;
+	const smallStr greeting = strTools::concatStr("Hello, ", "Ann", &arena);
+	return strTools::replaceStr("Hi {name}!", "{name}", greeting, &arena).toUniqueStr();
+}
+
+uniqueStr warnCheckUtf8Lower() {
+	return strUtil::utf8ToLower("ÀÉÎ Straße");
+}
+
+int64_t warnCheckUtf8Find() {
+	return strTools::findSubStrUtf8("Grüße aus KÖLN", "köln");
+}